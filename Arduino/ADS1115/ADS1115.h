@@ -109,6 +109,8 @@ THE SOFTWARE.
 #define ADS1115_RATE_475            0x06
 #define ADS1115_RATE_860            0x07
 
+#define ADS1115_RATE_TOLERANCE      10 // data rate accuracy in percent
+
 #define ADS1115_COMP_MODE_HYSTERESIS    0x00 // default
 #define ADS1115_COMP_MODE_WINDOW        0x01
 
@@ -148,7 +150,9 @@ class ADS1115 {
                                                                                      devAddr(address),
                                                                                      devMode(false),
                                                                                      muxMode(0),
-                                                                                     pgaMode(0)
+                                                                                     pgaMode(0),
+                                                                                     rateMode(ADS1115_RATE_128),
+                                                                                     conversionStart(0)
                                                                                      {
         }
 /*
@@ -161,8 +165,13 @@ class ADS1115 {
 
         // SINGLE SHOT utilities
         bool pollConversion(uint16_t max_retries);
+        bool waitForConversion();
         void triggerConversion();
 
+        // Non-blocking conversion
+        void startConversion();
+        bool tryGetResult(int16_t *value);
+
         // Read the current CONVERSION register
         int16_t getConversion(bool triggerAndPoll=true);
 
@@ -181,8 +190,11 @@ class ADS1115 {
         // Utility
         float getMilliVolts(bool triggerAndPoll=true);
         float getMvPerCount();
+        uint32_t getConversionTime();
 
         // CONFIG register
+        uint16_t getConfig();
+        void setConfig(uint16_t config);
         bool isConversionReady();
         uint8_t getMultiplexer();
         void setMultiplexer(uint8_t mux);
@@ -217,6 +229,8 @@ class ADS1115 {
         bool    devMode;
         uint8_t muxMode;
         uint8_t pgaMode;
+        uint8_t rateMode;
+        uint32_t conversionStart;
 };
 
 /** Power on and prepare for general usage.
@@ -249,6 +263,8 @@ bool ADS1115<WIRE>::testConnection() {
 /** Poll the operational status bit until the conversion is finished
  * Retry at most 'max_retries' times
  * conversion is finished, then return true;
+ * Every retry is a bus transaction; waitForConversion() is usually preferable.
+ * @see waitForConversion()
  * @see ADS1115_CFG_OS_BIT
  * @return True if data is available, false otherwise
  */
@@ -260,6 +276,60 @@ bool ADS1115<WIRE>::pollConversion(uint16_t max_retries) {
   return false;
 }
 
+/** Wait for the conversion started last to finish.
+ * Instead of polling the bus, this waits out the worst-case conversion time
+ * of the current data rate, counted from the last trigger. Waits of a
+ * millisecond or more go through delay(), which yields to other tasks on
+ * cooperative cores (ESP8266, ESP32). Completion is then confirmed with at most
+ * two CONFIG reads, so the bus stays free for other devices in the meantime.
+ * @return True if the conversion is finished, false otherwise
+ * @see getConversionTime()
+ * @see ADS1115_CFG_OS_BIT
+ */
+template <typename WIRE>
+bool ADS1115<WIRE>::waitForConversion() {
+    uint32_t period = getConversionTime();
+    uint32_t elapsed = micros() - conversionStart;
+    if (elapsed < period) {
+        uint32_t remaining = period - elapsed;
+        if (remaining >= 1000) delay(remaining / 1000);
+        delayMicroseconds(remaining % 1000);
+    }
+    if (isConversionReady()) return true;
+    // the oscillator is beyond its tolerance; give it another 1/16 period
+    delayMicroseconds(period / 16 + 1);
+    return isConversionReady();
+}
+
+/** Start a single-shot conversion and return immediately.
+ * The result is collected later with tryGetResult(), which makes this pair
+ * usable from cooperative schedulers that must not block.
+ * @see tryGetResult()
+ */
+template <typename WIRE>
+void ADS1115<WIRE>::startConversion() {
+    triggerConversion();
+}
+
+/** Fetch the result of the conversion started last, if it is finished.
+ * Makes no bus transaction at all until the worst-case conversion time of the
+ * current data rate has elapsed, then confirms completion with a single
+ * CONFIG read. In continuous mode the latest result is returned right away.
+ * @param value Destination for the 16-bit signed conversion result
+ * @return True if value was written, false if the conversion is still running
+ * @see startConversion()
+ * @see getConversionTime()
+ */
+template <typename WIRE>
+bool ADS1115<WIRE>::tryGetResult(int16_t *value) {
+    if (devMode == ADS1115_MODE_SINGLESHOT) {
+        if (micros() - conversionStart < getConversionTime()) return false;
+        if (!isConversionReady()) return false;
+    }
+    *value = getConversion(false);
+    return true;
+}
+
 /** Read differential value based on current MUX configuration.
  * The default MUX setting sets the device to get the differential between the
  * AIN0 and AIN1 pins. There are 8 possible MUX settings, but if you are using
@@ -276,7 +346,7 @@ bool ADS1115<WIRE>::pollConversion(uint16_t max_retries) {
  * comparison circuitry when needed.
  *
  * @param triggerAndPoll If true (and only in singleshot mode) the conversion trigger
- *        will be executed and the conversion results will be polled.
+ *        will be executed and the conversion results will be awaited.
  * @return 16-bit signed differential value
  * @see getConversionP0N1();
  * @see getConversionPON3();
@@ -286,6 +356,7 @@ bool ADS1115<WIRE>::pollConversion(uint16_t max_retries) {
  * @see getConversionP1GND();
  * @see getConversionP2GND();
  * @see getConversionP3GND);
+ * @see waitForConversion();
  * @see setMultiplexer();
  * @see ADS1115_RA_CONVERSION
  * @see ADS1115_MUX_P0_N1
@@ -301,7 +372,7 @@ template <typename WIRE>
 int16_t ADS1115<WIRE>::getConversion(bool triggerAndPoll) {
     if (triggerAndPoll && devMode == ADS1115_MODE_SINGLESHOT) {
       triggerConversion();
-      pollConversion(I2CDEV_DEFAULT_READ_TIMEOUT);
+      waitForConversion();
     }
     _i2cdev.readWord(devAddr, ADS1115_RA_CONVERSION, buffer);
     return buffer[0];
@@ -484,8 +555,55 @@ float ADS1115<WIRE>::getMvPerCount() {
   }
 }
 
+/** Get the worst-case duration of one conversion at the current data rate.
+ * The nominal period 1/DR is stretched by the internal oscillator tolerance,
+ * so a conversion started now is guaranteed to be complete after this time.
+ * Uses the locally stored data rate, no bus transaction is made.
+ * @return Conversion time in microseconds
+ * @see ADS1115_RATE_TOLERANCE
+ * @see setRate()
+ */
+template <typename WIRE>
+uint32_t ADS1115<WIRE>::getConversionTime() {
+    static const uint16_t sps[] = { 8, 16, 32, 64, 128, 250, 475, 860 };
+    return (1000000UL * (100 + ADS1115_RATE_TOLERANCE)) / (100UL * sps[rateMode & 0x07]) + 1;
+}
+
 // CONFIG register
 
+/** Get the whole CONFIG register.
+ * The locally stored MUX, PGA, MODE and DR settings are updated as well.
+ * @return Current CONFIG register value
+ * @see ADS1115_RA_CONFIG
+ */
+template <typename WIRE>
+uint16_t ADS1115<WIRE>::getConfig() {
+    _i2cdev.readWord(devAddr, ADS1115_RA_CONFIG, buffer);
+    muxMode = (buffer[0] >> (ADS1115_CFG_MUX_BIT - ADS1115_CFG_MUX_LENGTH + 1)) & 0x07;
+    pgaMode = (buffer[0] >> (ADS1115_CFG_PGA_BIT - ADS1115_CFG_PGA_LENGTH + 1)) & 0x07;
+    devMode = (buffer[0] >> ADS1115_CFG_MODE_BIT) & 0x01;
+    rateMode = (buffer[0] >> (ADS1115_CFG_DR_BIT - ADS1115_CFG_DR_LENGTH + 1)) & 0x07;
+    return buffer[0];
+}
+
+/** Write the whole CONFIG register in a single transaction.
+ * Unlike the individual setters this does not read the register first. Setting
+ * the OS bit while in single-shot mode starts a conversion with the new
+ * settings right away.
+ * @param config New CONFIG register value
+ * @see ADS1115_RA_CONFIG
+ */
+template <typename WIRE>
+void ADS1115<WIRE>::setConfig(uint16_t config) {
+    if (_i2cdev.writeWord(devAddr, ADS1115_RA_CONFIG, config)) {
+        muxMode = (config >> (ADS1115_CFG_MUX_BIT - ADS1115_CFG_MUX_LENGTH + 1)) & 0x07;
+        pgaMode = (config >> (ADS1115_CFG_PGA_BIT - ADS1115_CFG_PGA_LENGTH + 1)) & 0x07;
+        devMode = (config >> ADS1115_CFG_MODE_BIT) & 0x01;
+        rateMode = (config >> (ADS1115_CFG_DR_BIT - ADS1115_CFG_DR_LENGTH + 1)) & 0x07;
+        if (config & (1 << ADS1115_CFG_OS_BIT)) conversionStart = micros();
+    }
+}
+
 /** Get operational status.
  * @return Current operational status (false for active conversion, true for inactive)
  * @see ADS1115_RA_CONFIG
@@ -505,6 +623,7 @@ bool ADS1115<WIRE>::isConversionReady() {
 template <typename WIRE>
 void ADS1115<WIRE>::triggerConversion() {
     _i2cdev.writeBitW(devAddr, ADS1115_RA_CONFIG, ADS1115_CFG_OS_BIT, 1);
+    conversionStart = micros();
 }
 
 /** Get multiplexer connection.
@@ -627,7 +746,8 @@ void ADS1115<WIRE>::setMode(bool mode) {
 template <typename WIRE>
 uint8_t ADS1115<WIRE>::getRate() {
     _i2cdev.readBitsW(devAddr, ADS1115_RA_CONFIG, ADS1115_CFG_DR_BIT, ADS1115_CFG_DR_LENGTH, buffer);
-    return (uint8_t)buffer[0];
+    rateMode = (uint8_t)buffer[0];
+    return rateMode;
 }
 
 /** Set data rate.
@@ -646,7 +766,9 @@ uint8_t ADS1115<WIRE>::getRate() {
  */
 template <typename WIRE>
 void ADS1115<WIRE>::setRate(uint8_t rate) {
-    _i2cdev.writeBitsW(devAddr, ADS1115_RA_CONFIG, ADS1115_CFG_DR_BIT, ADS1115_CFG_DR_LENGTH, rate);
+    if (_i2cdev.writeBitsW(devAddr, ADS1115_RA_CONFIG, ADS1115_CFG_DR_BIT, ADS1115_CFG_DR_LENGTH, rate)) {
+        rateMode = rate;
+    }
 }
 
 /** Get comparator mode.
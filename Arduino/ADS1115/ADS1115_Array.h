@@ -0,0 +1,255 @@
+// I2Cdev library collection - ADS1115 multi-device interleaved acquisition
+// Runs up to four ADS1115s (one per ADDR strap) concurrently on one bus and
+// collects every conversion as soon as its device finishes
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _ADS1115_ARRAY_H_
+#define _ADS1115_ARRAY_H_
+
+#include "ADS1115_Scanner.h"
+
+// one device per ADDR strap (GND, VDD, SDA, SCL)
+#ifndef ADS1115_ARRAY_MAX_DEVICES
+#define ADS1115_ARRAY_MAX_DEVICES       4
+#endif
+
+#ifndef ADS1115_ARRAY_MAX_CHANNELS
+#define ADS1115_ARRAY_MAX_CHANNELS      8
+#endif
+
+// must be a power of two
+#ifndef ADS1115_ARRAY_BUFFER_SIZE
+#define ADS1115_ARRAY_BUFFER_SIZE       32
+#endif
+
+/** One conversion result of an array member. */
+struct ADS1115ArraySample {
+    uint32_t timestamp;     // micros() when the conversion was started
+    uint32_t latency;       // microseconds from conversion start to result read
+    int16_t value;          // raw CONVERSION register value
+    uint8_t device;         // array index of the device (order of addDevice())
+    uint8_t mux;            // ADS1115_MUX_* setting the value was taken with
+};
+
+template <typename WIRE>
+class ADS1115Array {
+  public:
+        ADS1115Array( const ADS1115Array& other ) = delete; // non construction-copyable
+        ADS1115Array & operator=( const ADS1115Array& ) = delete; // non copyable
+
+        ADS1115Array() : deviceCount(0),
+                         channelCount(4),
+                         running(false),
+                         overruns(0),
+                         maxLatency(0)
+                         {
+            for (uint8_t i = 0; i < 4; i++) channels[i] = ADS1115_MUX_P0_NG + i;
+        }
+
+        bool addDevice(ADS1115<WIRE> *device, int8_t readyPin = -1);
+        uint8_t getDeviceCount();
+        bool setChannels(const uint8_t *muxList, uint8_t count);
+
+        bool begin();
+        void stop();
+        bool isRunning();
+
+        uint8_t service();
+
+        uint8_t available();
+        bool getSample(ADS1115ArraySample *sample);
+        uint16_t getOverrunCount();
+        uint32_t getMaxLatency();
+
+  private:
+        ADS1115ScanStep<WIRE> members[ADS1115_ARRAY_MAX_DEVICES];
+        uint8_t deviceCount;
+        uint8_t channels[ADS1115_ARRAY_MAX_CHANNELS];
+        uint8_t channelCount;
+        bool running;
+        uint16_t overruns;
+        uint32_t maxLatency;
+        I2CdevRingBuffer<ADS1115ArraySample, ADS1115_ARRAY_BUFFER_SIZE> samples;
+};
+
+/** Add a device to the array.
+ * Each device must have its own address (see ADS1115_ADDRESS_ADDR_GND and
+ * friends), be initialized with the desired gain and data rate, and stay
+ * valid for the lifetime of the array.
+ * @param device Device to add
+ * @param readyPin Arduino pin connected to the device's ALERT/RDY output, or
+ *        -1 to pace it from the data rate timer (see ADS1115Scanner::setReadyPin())
+ * @return True if added, false if the array is full
+ * @see ADS1115_ARRAY_MAX_DEVICES
+ */
+template <typename WIRE>
+bool ADS1115Array<WIRE>::addDevice(ADS1115<WIRE> *device, int8_t readyPin) {
+    if (deviceCount >= ADS1115_ARRAY_MAX_DEVICES) return false;
+    members[deviceCount].adc = device;
+    members[deviceCount].readyPin = readyPin;
+    deviceCount++;
+    return true;
+}
+
+/** Get the number of devices in the array.
+ * @return Number of devices added so far
+ */
+template <typename WIRE>
+uint8_t ADS1115Array<WIRE>::getDeviceCount() {
+    return deviceCount;
+}
+
+/** Set the channels every device cycles through.
+ * Defaults to the four single-ended inputs, giving 16 channels with four
+ * devices. Takes effect on the next begin().
+ * @param muxList MUX settings to cycle through
+ * @param count Number of entries in muxList
+ * @return True if accepted, false if count is 0 or too large
+ * @see ADS1115_ARRAY_MAX_CHANNELS
+ */
+template <typename WIRE>
+bool ADS1115Array<WIRE>::setChannels(const uint8_t *muxList, uint8_t count) {
+    if (count == 0 || count > ADS1115_ARRAY_MAX_CHANNELS) return false;
+    for (uint8_t i = 0; i < count; i++) channels[i] = muxList[i] & 0x07;
+    channelCount = count;
+    return true;
+}
+
+/** Start all devices.
+ * The current CONFIG register of every device (gain, data rate, comparator) is
+ * taken as the template for its conversions, single-shot mode is forced and
+ * devices with a ready pin get ALERT/RDY switched to conversion-ready mode.
+ * The first conversion of each device is started back-to-back so the devices
+ * run concurrently from here on. Queued samples and statistics are reset.
+ * @return True if started, false if the array is empty
+ */
+template <typename WIRE>
+bool ADS1115Array<WIRE>::begin() {
+    if (deviceCount == 0) return false;
+    for (uint8_t i = 0; i < deviceCount; i++) members[i].prepare();
+    samples.drop();
+    overruns = 0;
+    maxLatency = 0;
+    for (uint8_t i = 0; i < deviceCount; i++) members[i].start(channels[0]);
+    running = true;
+    return true;
+}
+
+/** Stop all devices.
+ * Conversions in progress finish on their own and are not queued; samples
+ * already queued remain available.
+ */
+template <typename WIRE>
+void ADS1115Array<WIRE>::stop() {
+    running = false;
+}
+
+/** Check whether acquisition is in progress.
+ * @return True between begin() and stop()
+ */
+template <typename WIRE>
+bool ADS1115Array<WIRE>::isRunning() {
+    return running;
+}
+
+/** Collect finished conversions and restart their devices.
+ * Never blocks and never polls the CONFIG registers. Every device whose
+ * conversion is complete (by timer or ready pin) gets its next channel started
+ * first and its finished result read second, the same step ADS1115Scanner
+ * uses, so each device is idle only for the duration of one CONFIG write.
+ * With all devices converting in parallel the aggregate rate approaches the
+ * device count times the single-device rate, as long as the bus can carry the
+ * two transactions per conversion (at 860 SPS with four devices that requires
+ * 400kHz I2C).
+ *
+ * The latency stored with each sample is the time from conversion start to
+ * result read, i.e. the conversion time plus any delay in calling service().
+ *
+ * @return Number of samples produced
+ * @see getSample()
+ * @see getMaxLatency()
+ */
+template <typename WIRE>
+uint8_t ADS1115Array<WIRE>::service() {
+    if (!running) return 0;
+    uint8_t produced = 0;
+    for (uint8_t i = 0; i < deviceCount; i++) {
+        ADS1115Sample result;
+        if (!members[i].poll(channels, channelCount, &result)) continue;
+
+        ADS1115ArraySample sample;
+        sample.timestamp = result.timestamp;
+        sample.latency = micros() - result.timestamp;
+        sample.value = result.value;
+        sample.device = i;
+        sample.mux = result.mux;
+        if (sample.latency > maxLatency) maxLatency = sample.latency;
+
+        if (!samples.push(sample)) overruns++;
+        produced++;
+    }
+    return produced;
+}
+
+/** Get the number of queued samples.
+ * @return Samples ready to be fetched with getSample()
+ */
+template <typename WIRE>
+uint8_t ADS1115Array<WIRE>::available() {
+    return samples.available();
+}
+
+/** Fetch the oldest queued sample.
+ * @param sample Sample to fill
+ * @return True if a sample was returned, false if the queue is empty
+ */
+template <typename WIRE>
+bool ADS1115Array<WIRE>::getSample(ADS1115ArraySample *sample) {
+    return samples.pop(sample);
+}
+
+/** Get the number of samples dropped because the queue was full.
+ * @return Overrun count since begin()
+ */
+template <typename WIRE>
+uint16_t ADS1115Array<WIRE>::getOverrunCount() {
+    return overruns;
+}
+
+/** Get the largest conversion latency seen since begin().
+ * Values well above the conversion time indicate that service() is called
+ * too rarely or the bus is saturated.
+ * @return Maximum start-to-read latency in microseconds
+ */
+template <typename WIRE>
+uint32_t ADS1115Array<WIRE>::getMaxLatency() {
+    return maxLatency;
+}
+
+#endif /* _ADS1115_ARRAY_H_ */
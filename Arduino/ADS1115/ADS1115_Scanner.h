@@ -0,0 +1,282 @@
+// I2Cdev library collection - ADS1115 multi-channel scan engine
+// Cycles an ADS1115 through a list of MUX settings at close to the programmed
+// data rate and queues time-stamped results without busy-polling the bus
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _ADS1115_SCANNER_H_
+#define _ADS1115_SCANNER_H_
+
+#include "ADS1115.h"
+#include "I2Cdev_RingBuffer.h"
+
+// all eight MUX settings
+#ifndef ADS1115_SCANNER_MAX_CHANNELS
+#define ADS1115_SCANNER_MAX_CHANNELS    8
+#endif
+
+// must be a power of two
+#ifndef ADS1115_SCANNER_BUFFER_SIZE
+#define ADS1115_SCANNER_BUFFER_SIZE     16
+#endif
+
+/** One conversion result of a scan. */
+struct ADS1115Sample {
+    uint32_t timestamp;     // micros() when the conversion was started
+    int16_t value;          // raw CONVERSION register value
+    uint8_t mux;            // ADS1115_MUX_* setting the value was taken with
+};
+
+/** Conversion sequencing of one device.
+ * Shared by ADS1115Scanner and ADS1115Array so both pace, restart and read a
+ * device the same way. Holds the CONFIG template and the timing of the
+ * conversion in progress; the channel list belongs to the caller.
+ */
+template <typename WIRE>
+struct ADS1115ScanStep {
+    ADS1115<WIRE> *adc;
+    int8_t readyPin;            // ALERT/RDY pin, or -1 to use the timer
+    uint8_t index;              // channel list position being converted
+    uint16_t config;            // CONFIG word without OS and MUX bits
+    uint32_t period;            // worst-case conversion time in microseconds
+    uint32_t started;           // micros() when the current conversion started
+
+    void prepare();
+    void start(uint8_t mux);
+    bool poll(const uint8_t *channels, uint8_t channelCount, ADS1115Sample *sample);
+};
+
+template <typename WIRE>
+class ADS1115Scanner {
+  public:
+        ADS1115Scanner() = delete;
+        ADS1115Scanner( const ADS1115Scanner& other ) = delete; // non construction-copyable
+        ADS1115Scanner & operator=( const ADS1115Scanner& ) = delete; // non copyable
+
+        /** Create a scanner for an ADS1115.
+         * @param adc Device to scan, must stay valid for the lifetime of the scanner
+         */
+        ADS1115Scanner(ADS1115<WIRE>& adc) : channelCount(0),
+                                             running(false),
+                                             overruns(0)
+                                             {
+            step.adc = &adc;
+            step.readyPin = -1;
+            step.index = 0;
+        }
+
+        bool setChannels(const uint8_t *muxList, uint8_t count);
+        void setReadyPin(int8_t pin);
+
+        bool begin();
+        void stop();
+        bool isRunning();
+
+        bool service();
+
+        uint8_t available();
+        bool getSample(ADS1115Sample *sample);
+        uint16_t getOverrunCount();
+
+  private:
+        ADS1115ScanStep<WIRE> step;
+        uint8_t channels[ADS1115_SCANNER_MAX_CHANNELS];
+        uint8_t channelCount;
+        bool running;
+        uint16_t overruns;
+        I2CdevRingBuffer<ADS1115Sample, ADS1115_SCANNER_BUFFER_SIZE> samples;
+};
+
+/** Take the device's current CONFIG register as the conversion template.
+ * Gain, data rate and comparator settings are kept, single-shot mode is
+ * forced, and the ALERT/RDY pin is switched to conversion-ready mode if a
+ * ready pin is set. Restarts at the first channel.
+ */
+template <typename WIRE>
+void ADS1115ScanStep<WIRE>::prepare() {
+    if (readyPin >= 0) adc->setConversionReadyPinMode();
+    config = adc->getConfig();
+    config &= ~((1 << ADS1115_CFG_OS_BIT) | (0x07 << (ADS1115_CFG_MUX_BIT - ADS1115_CFG_MUX_LENGTH + 1)));
+    config |= ADS1115_MODE_SINGLESHOT << ADS1115_CFG_MODE_BIT;
+    period = adc->getConversionTime();
+    index = 0;
+}
+
+/** Start a single-shot conversion.
+ * One CONFIG write carries the MUX setting and the OS bit together.
+ * @param mux MUX setting to convert
+ */
+template <typename WIRE>
+void ADS1115ScanStep<WIRE>::start(uint8_t mux) {
+    adc->setConfig(config | (1 << ADS1115_CFG_OS_BIT) | (mux << (ADS1115_CFG_MUX_BIT - ADS1115_CFG_MUX_LENGTH + 1)));
+    started = micros();
+}
+
+/** Advance to the next channel if the current conversion is complete.
+ * Never blocks and never polls the CONFIG register. Completion is decided from
+ * the elapsed time, or from the ALERT/RDY pin if one is set. When complete,
+ * the next channel is started first and only then is the finished result
+ * read. The CONVERSION register is not overwritten until the new conversion
+ * ends, so reading it while the device is already converting the next
+ * channel is safe and keeps the device busy for all but the two bus
+ * transactions.
+ * @param channels Channel list being cycled through
+ * @param channelCount Number of entries in channels
+ * @param sample Filled with the finished conversion
+ * @return True if a sample was produced
+ */
+template <typename WIRE>
+bool ADS1115ScanStep<WIRE>::poll(const uint8_t *channels, uint8_t channelCount, ADS1115Sample *sample) {
+    uint32_t elapsed = micros() - started;
+    if (readyPin >= 0) {
+        // the pin may still show the previous completion right after a start
+        if (elapsed < period / 2 || digitalRead(readyPin) != LOW) return false;
+    } else if (elapsed < period) {
+        return false;
+    }
+
+    uint8_t next = index + 1 < channelCount ? index + 1 : 0;
+    sample->timestamp = started;
+    sample->mux = channels[index];
+    start(channels[next]);
+    sample->value = adc->getConversion(false);
+    index = next;
+    return true;
+}
+
+/** Set the list of channels to scan.
+ * Channels are converted in list order, then the list repeats. The same MUX
+ * setting may appear more than once to sample it more often. Takes effect on
+ * the next begin().
+ * @param muxList MUX settings to cycle through
+ * @param count Number of entries in muxList
+ * @return True if accepted, false if count is 0 or too large
+ * @see ADS1115_MUX_P0_NG
+ * @see ADS1115_SCANNER_MAX_CHANNELS
+ */
+template <typename WIRE>
+bool ADS1115Scanner<WIRE>::setChannels(const uint8_t *muxList, uint8_t count) {
+    if (count == 0 || count > ADS1115_SCANNER_MAX_CHANNELS) return false;
+    for (uint8_t i = 0; i < count; i++) channels[i] = muxList[i] & 0x07;
+    channelCount = count;
+    return true;
+}
+
+/** Pace the scan from the ALERT/RDY pin instead of the data rate timer.
+ * The pin is switched to conversion-ready mode on begin() and must already be
+ * configured as an input (it is open-drain, so a pull-up is required). A
+ * conversion is only considered complete once the pin is low, which removes
+ * the oscillator tolerance margin from every step.
+ * @param pin Arduino pin connected to ALERT/RDY, or -1 to use the timer
+ * @see ADS1115::setConversionReadyPinMode()
+ */
+template <typename WIRE>
+void ADS1115Scanner<WIRE>::setReadyPin(int8_t pin) {
+    step.readyPin = pin;
+}
+
+/** Start scanning.
+ * The current CONFIG register (gain, data rate, comparator) is taken as the
+ * template for every conversion, single-shot mode is forced and the first
+ * channel is started. Queued samples from a previous scan are discarded.
+ * @return True if the scan was started, false if no channels are set
+ */
+template <typename WIRE>
+bool ADS1115Scanner<WIRE>::begin() {
+    if (channelCount == 0) return false;
+    step.prepare();
+    samples.drop();
+    overruns = 0;
+    step.start(channels[0]);
+    running = true;
+    return true;
+}
+
+/** Stop scanning.
+ * The conversion in progress finishes on its own and is not queued; samples
+ * already queued remain available.
+ */
+template <typename WIRE>
+void ADS1115Scanner<WIRE>::stop() {
+    running = false;
+}
+
+/** Check whether a scan is in progress.
+ * @return True between begin() and stop()
+ */
+template <typename WIRE>
+bool ADS1115Scanner<WIRE>::isRunning() {
+    return running;
+}
+
+/** Advance the scan if the current conversion is complete.
+ * See ADS1115ScanStep::poll() for how completion is detected and why the next
+ * channel is started before the result is read.
+ *
+ * Call this at least once per conversion period; a scan step that cannot be
+ * queued because the buffer is full is counted as an overrun and dropped.
+ *
+ * @return True if a sample was produced
+ * @see getSample()
+ * @see getOverrunCount()
+ */
+template <typename WIRE>
+bool ADS1115Scanner<WIRE>::service() {
+    if (!running) return false;
+    ADS1115Sample sample;
+    if (!step.poll(channels, channelCount, &sample)) return false;
+    if (!samples.push(sample)) overruns++;
+    return true;
+}
+
+/** Get the number of queued samples.
+ * @return Samples ready to be fetched with getSample()
+ */
+template <typename WIRE>
+uint8_t ADS1115Scanner<WIRE>::available() {
+    return samples.available();
+}
+
+/** Fetch the oldest queued sample.
+ * @param sample Sample to fill
+ * @return True if a sample was returned, false if the queue is empty
+ */
+template <typename WIRE>
+bool ADS1115Scanner<WIRE>::getSample(ADS1115Sample *sample) {
+    return samples.pop(sample);
+}
+
+/** Get the number of samples dropped because the queue was full.
+ * @return Overrun count since begin()
+ */
+template <typename WIRE>
+uint16_t ADS1115Scanner<WIRE>::getOverrunCount() {
+    return overruns;
+}
+
+#endif /* _ADS1115_SCANNER_H_ */
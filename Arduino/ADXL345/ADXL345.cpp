@@ -37,6 +37,9 @@ THE SOFTWARE.
  */
 ADXL345::ADXL345() {
     devAddr = ADXL345_DEFAULT_ADDRESS;
+    fifoSynced = false;
+    fifoOverruns = 0;
+    fifoInterruptPending = false;
 }
 
 /** Specific address constructor.
@@ -47,6 +50,9 @@ ADXL345::ADXL345() {
  */
 ADXL345::ADXL345(uint8_t address) {
     devAddr = address;
+    fifoSynced = false;
+    fifoOverruns = 0;
+    fifoInterruptPending = false;
 }
 
 /** Power on and prepare for general usage.
@@ -1666,3 +1672,127 @@ uint8_t ADXL345::getFIFOLength() {
     I2Cdev::readBits(devAddr, ADXL345_RA_FIFO_STATUS, ADXL345_FIFOSTAT_LENGTH_BIT, ADXL345_FIFOSTAT_LENGTH_LENGTH, buffer);
     return buffer[0];
 }
+
+// FIFO stream acquisition
+
+/** Arm the FIFO in stream mode with a watermark interrupt.
+ * FIFO_CTL is written in one transaction (stream mode, watermark level) and
+ * the WATERMARK interrupt is routed to the selected pin and enabled. The pin
+ * stays asserted while at least watermark entries are queued; attach
+ * handleFIFOInterrupt() to it on a RISING edge (or FALLING with inverted
+ * interrupt polarity) and call readFIFOStream() afterwards.
+ *
+ * The output rate is read once here to align sample timestamps, so set the
+ * rate with setRate() before calling this. At 3200Hz each entry has to be read
+ * within 312us on average, which needs a 400kHz bus.
+ *
+ * @param watermark FIFO entries that trigger the interrupt (1-31)
+ * @param pin Interrupt pin for the watermark event (0 = INT1, 1 = INT2)
+ * @see ADXL345_RATE_3200
+ */
+void ADXL345::startFIFOStream(uint8_t watermark, uint8_t pin) {
+    if (watermark < 1) watermark = 1;
+    if (watermark > ADXL345_FIFO_DEPTH - 1) watermark = ADXL345_FIFO_DEPTH - 1;
+    fifoWatermark = watermark;
+    // 3200Hz is 312.5us, every lower rate code halves the frequency
+    fifoPeriod = (uint32_t)625 << (ADXL345_RATE_3200 - getRate());
+    fifoSynced = false;
+    fifoOverruns = 0;
+    fifoInterruptPending = false;
+    setIntWatermarkEnabled(false);
+    I2Cdev::writeByte(devAddr, ADXL345_RA_FIFO_CTL, (ADXL345_FIFO_MODE_STREAM << (ADXL345_FIFO_MODE_BIT - ADXL345_FIFO_MODE_LENGTH + 1)) | watermark);
+    setIntWatermarkPin(pin);
+    setIntWatermarkEnabled(true);
+}
+
+/** Disable the watermark interrupt and bypass the FIFO. */
+void ADXL345::stopFIFOStream() {
+    setIntWatermarkEnabled(false);
+    I2Cdev::writeByte(devAddr, ADXL345_RA_FIFO_CTL, 0);
+    fifoInterruptPending = false;
+}
+
+/** Record the watermark interrupt time; call this from the interrupt ISR.
+ * Only the micros() timestamp is captured here, no bus traffic is generated.
+ * When set, it is used as the reference for the entry that reached the
+ * watermark instead of the time of the next readFIFOStream() call.
+ */
+void ADXL345::handleFIFOInterrupt() {
+    if (fifoInterruptPending) return;
+    fifoInterruptTime = micros();
+    fifoInterruptPending = true;
+}
+
+/** Drain queued FIFO entries into a caller buffer.
+ * INT_SOURCE and FIFO_STATUS are read once, then every entry is read with a
+ * back-to-back 6-byte DATAX0 burst (each burst pops one FIFO level; the
+ * register pointer does not wrap, so one burst per entry is the minimum).
+ *
+ * Timestamps are spaced exactly by the configured output period. They continue
+ * from the previous call and are pulled towards the interrupt (or read) time
+ * by 1/8 of the difference on every call, which tracks the drift between the
+ * sensor and MCU clocks without adding jitter. After an overrun the sequence is
+ * restarted from the reference time.
+ *
+ * @param samples Buffer to fill, oldest entry first
+ * @param maxSamples Capacity of samples; entries beyond it stay queued
+ * @return Number of entries read
+ * @see getFIFOOverrunCount()
+ */
+uint8_t ADXL345::readFIFOStream(ADXL345FIFOSample *samples, uint8_t maxSamples) {
+    bool overrun = false;
+    uint32_t reference;
+    uint8_t referenceIndex;
+
+    I2Cdev::readByte(devAddr, ADXL345_RA_INT_SOURCE, buffer);
+    if (buffer[0] & (1 << ADXL345_INT_OVERRUN_BIT)) overrun = true;
+    uint32_t now = micros();
+    uint8_t count = getFIFOLength();
+    if (count == 0) return 0;
+
+    // newest entry was produced at the interrupt (watermark entry) or just now
+    if (fifoInterruptPending && count >= fifoWatermark) {
+        reference = fifoInterruptTime;
+        referenceIndex = fifoWatermark - 1;
+    } else {
+        reference = now;
+        referenceIndex = count - 1;
+    }
+    fifoInterruptPending = false;
+    if (count > maxSamples) count = maxSamples;
+
+    // time of the first entry in 1/2 microseconds relative to reference
+    int32_t expected = 0;
+    int32_t anchored = -(int32_t)(referenceIndex * fifoPeriod);
+    if (overrun) fifoOverruns++;
+    if (fifoSynced && !overrun) {
+        expected = (int32_t)((fifoLastTimestamp - reference) << 1) + fifoLastHalf + (int32_t)fifoPeriod;
+        int32_t error = anchored - expected;
+        if (error > 2 * (int32_t)fifoPeriod || error < -2 * (int32_t)fifoPeriod) expected = anchored;
+        else expected += error / 8;
+    } else {
+        expected = anchored;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 6, buffer);
+        int32_t t = expected + (int32_t)(i * fifoPeriod);
+        samples[i].timestamp = reference + (t >> 1);
+        samples[i].x = (((int16_t)buffer[1]) << 8) | buffer[0];
+        samples[i].y = (((int16_t)buffer[3]) << 8) | buffer[2];
+        samples[i].z = (((int16_t)buffer[5]) << 8) | buffer[4];
+        fifoLastHalf = t & 0x01;
+    }
+    fifoLastTimestamp = samples[count - 1].timestamp;
+    fifoSynced = true;
+    return count;
+}
+
+/** Get the number of FIFO overruns since startFIFOStream().
+ * An overrun means at least one sample was overwritten in the FIFO before it
+ * was read; the timestamp sequence restarts after each one.
+ * @return Overrun count
+ */
+uint16_t ADXL345::getFIFOOverrunCount() {
+    return fifoOverruns;
+}
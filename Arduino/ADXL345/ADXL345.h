@@ -163,6 +163,14 @@ THE SOFTWARE.
 #define ADXL345_FIFOSTAT_LENGTH_BIT         5
 #define ADXL345_FIFOSTAT_LENGTH_LENGTH      6
 
+#define ADXL345_FIFO_DEPTH          32
+
+/** One time-stamped FIFO entry. */
+struct ADXL345FIFOSample {
+    uint32_t timestamp;     // micros() when the sample was produced, aligned to the output rate
+    int16_t x, y, z;
+};
+
 class ADXL345 {
     public:
         ADXL345();
@@ -353,9 +361,25 @@ class ADXL345 {
         bool getFIFOTriggerOccurred();
         uint8_t getFIFOLength();
 
+        // FIFO stream acquisition
+        void startFIFOStream(uint8_t watermark=16, uint8_t pin=0);
+        void stopFIFOStream();
+        void handleFIFOInterrupt();
+        uint8_t readFIFOStream(ADXL345FIFOSample *samples, uint8_t maxSamples);
+        uint16_t getFIFOOverrunCount();
+
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+
+        uint8_t fifoWatermark;
+        uint32_t fifoPeriod;            // output period in 1/2 microseconds
+        uint32_t fifoLastTimestamp;
+        uint8_t fifoLastHalf;           // 1/2 microsecond dropped from fifoLastTimestamp
+        bool fifoSynced;
+        uint16_t fifoOverruns;
+        volatile uint32_t fifoInterruptTime;
+        volatile bool fifoInterruptPending;
 };
 
 #endif /* _ADXL345_H_ */
@@ -38,6 +38,9 @@ THE SOFTWARE.
  */
 AK8963::AK8963() {
     devAddr = AK8963_DEFAULT_ADDRESS;
+    resolution = AK8963_RES_14_BIT;
+    readyPin = -1;
+    measuring = false;
 }
 
 /** Specific address constructor.
@@ -47,6 +50,9 @@ AK8963::AK8963() {
  */
 AK8963::AK8963(uint8_t address) {
     devAddr = address;
+    resolution = AK8963_RES_14_BIT;
+    readyPin = -1;
+    measuring = false;
 }
 
 /** Power on and prepare for general usage.
@@ -93,8 +99,13 @@ bool AK8963::getDataOverrun() {
 }
 
 // H* registers
+/** Read the latest heading on all three axes.
+ * ST2 is read in the same burst; in continuous mode the device does not
+ * update the data registers for a new sample until ST2 has been read.
+ * @see getMeasurement()
+ */
 void AK8963::getHeading(int16_t *x, int16_t *y, int16_t *z) {
-    I2Cdev::readBytes(devAddr, AK8963_RA_HXL, 6, buffer);
+    I2Cdev::readBytes(devAddr, AK8963_RA_HXL, 7, buffer);
     *x = (((int16_t)buffer[1]) << 8) | buffer[0];
     *y = (((int16_t)buffer[3]) << 8) | buffer[2];
     *z = (((int16_t)buffer[5]) << 8) | buffer[4];
@@ -132,10 +143,12 @@ void AK8963::setMode(uint8_t mode) {
 }
 uint8_t AK8963::getResolution() {
     I2Cdev::readBit(devAddr, AK8963_RA_CNTL1, AK8963_CNTL1_RES_BIT, buffer);
+    resolution = buffer[0];
     return buffer[0];
 }
 void AK8963::setResolution(uint8_t res) {
     I2Cdev::writeBit(devAddr, AK8963_RA_CNTL1, AK8963_CNTL1_RES_BIT, res);
+    resolution = res;
 }
 
 // CNTL2 register
@@ -187,3 +200,94 @@ uint8_t AK8963::getAdjustmentZ() {
 void AK8963::setAdjustmentZ(uint8_t z) {
     I2Cdev::writeByte(devAddr, AK8963_RA_ASAZ, z);
 }
+
+// non-blocking measurement
+
+/** Use the DRDY pin to detect new data.
+ * The pin must already be configured as an input. While it is set, polling
+ * does not generate any bus traffic until the pin goes high.
+ * @param pin Arduino pin connected to DRDY, or -1 to use the ST1 DRDY bit
+ */
+void AK8963::setReadyPin(int8_t pin) {
+    readyPin = pin;
+}
+
+/** Trigger a single measurement without waiting for it.
+ * CNTL1 is written in one transaction using the resolution last set with
+ * setResolution() or read with getResolution() (14-bit after power-up). The
+ * device returns to power-down mode by itself when the measurement is done.
+ * Collect the result with pollMeasurement().
+ */
+void AK8963::startMeasurement() {
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, (resolution << AK8963_CNTL1_RES_BIT) | AK8963_MODE_SINGLE);
+    measureStart = micros();
+    measurePeriod = 0;
+    measuring = true;
+}
+
+/** Switch to continuous measurement mode.
+ * The device passes through power-down mode first, as required when changing
+ * between measurement modes. New samples are then produced at 8Hz or 100Hz
+ * without any further trigger; collect them with pollMeasurement().
+ * @param mode AK8963_MODE_CONTINUOUS_8HZ or AK8963_MODE_CONTINUOUS_100HZ
+ */
+void AK8963::startContinuous(uint8_t mode) {
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, (resolution << AK8963_CNTL1_RES_BIT) | AK8963_MODE_POWERDOWN);
+    delayMicroseconds(100);
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, (resolution << AK8963_CNTL1_RES_BIT) | mode);
+    measureStart = micros();
+    measurePeriod = mode == AK8963_MODE_CONTINUOUS_8HZ ? 125000 : 10000;
+    measuring = true;
+}
+
+/** Stop continuous measurements and enter power-down mode. */
+void AK8963::stopMeasurement() {
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, (resolution << AK8963_CNTL1_RES_BIT) | AK8963_MODE_POWERDOWN);
+    measuring = false;
+}
+
+/** Read ST1, HXL..HZH and ST2 in one 8-byte burst.
+ * The heading is only written when ST1 reports new data. Reading ST2 as part
+ * of the burst releases the data registers for the next continuous sample.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return 1 if a new sample was read, 0 if no data is ready, -1 if the sample
+ *         is invalid (magnetic overflow)
+ * @see getDataOverrun()
+ */
+int8_t AK8963::getMeasurement(int16_t *x, int16_t *y, int16_t *z) {
+    if (I2Cdev::readBytes(devAddr, AK8963_RA_ST1, 8, buffer) != 8) return 0;
+    if (!(buffer[0] & (1 << AK8963_ST1_DRDY_BIT))) return 0;
+    if (measurePeriod == 0) measuring = false;
+    *x = (((int16_t)buffer[2]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[4]) << 8) | buffer[3];
+    *z = (((int16_t)buffer[6]) << 8) | buffer[5];
+    if (buffer[7] & (1 << AK8963_ST2_HOFL_BIT)) return -1;
+    return 1;
+}
+
+/** Collect a new sample if one is available.
+ * Never blocks. No bus traffic is generated until the DRDY pin is high (see
+ * setReadyPin()) or, without the pin, until the maximum measurement time (single
+ * mode) or one output period since the last sample (continuous mode) has
+ * passed, so a sample normally costs a single burst read.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return 1 if a new sample was read, 0 if not ready yet or no measurement
+ *         is running, -1 if the sample is invalid
+ * @see getMeasurement()
+ */
+int8_t AK8963::pollMeasurement(int16_t *x, int16_t *y, int16_t *z) {
+    if (!measuring) return 0;
+    uint32_t now = micros();
+    if (readyPin >= 0) {
+        if (digitalRead(readyPin) != HIGH) return 0;
+    } else if (now - measureStart < (measurePeriod ? measurePeriod : AK8963_MEASURE_TIME_US)) {
+        return 0;
+    }
+    int8_t result = getMeasurement(x, y, z);
+    if (result != 0) measureStart = now;
+    return result;
+}
@@ -91,6 +91,8 @@ THE SOFTWARE.
 
 #define AK8963_I2CDIS_DISABLE           0x1B
 
+#define AK8963_MEASURE_TIME_US          9000 // maximum single measurement time
+
 class AK8963 {
     public:
         AK8963();
@@ -142,10 +144,23 @@ class AK8963 {
         uint8_t getAdjustmentZ();
         void setAdjustmentZ(uint8_t z);
 
+        // non-blocking measurement
+        void setReadyPin(int8_t pin);
+        void startMeasurement();
+        void startContinuous(uint8_t mode=AK8963_MODE_CONTINUOUS_100HZ);
+        void stopMeasurement();
+        int8_t getMeasurement(int16_t *x, int16_t *y, int16_t *z);
+        int8_t pollMeasurement(int16_t *x, int16_t *y, int16_t *z);
+
     private:
         uint8_t devAddr;
-        uint8_t buffer[6];
+        uint8_t buffer[8];
         uint8_t mode;
+        uint8_t resolution;
+        int8_t readyPin;
+        bool measuring;
+        uint32_t measureStart;
+        uint32_t measurePeriod;
 };
 
 #endif /* _AK8963_H_ */
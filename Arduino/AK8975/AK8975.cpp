@@ -37,6 +37,8 @@ THE SOFTWARE.
  */
 AK8975::AK8975() {
     devAddr = AK8975_DEFAULT_ADDRESS;
+    readyPin = -1;
+    measuring = false;
 }
 
 /** Specific address constructor.
@@ -46,6 +48,8 @@ AK8975::AK8975() {
  */
 AK8975::AK8975(uint8_t address) {
     devAddr = address;
+    readyPin = -1;
+    measuring = false;
 }
 
 /** Power on and prepare for general usage.
@@ -87,29 +91,45 @@ bool AK8975::getDataReady() {
 }
 
 // H* registers
-void AK8975::getHeading(int16_t *x, int16_t *y, int16_t *z) {
-    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
-    delay(10);
-    I2Cdev::readBytes(devAddr, AK8975_RA_HXL, 6, buffer);
-    *x = (((int16_t)buffer[1]) << 8) | buffer[0];
-    *y = (((int16_t)buffer[3]) << 8) | buffer[2];
-    *z = (((int16_t)buffer[5]) << 8) | buffer[4];
+
+/** Take a single measurement of all three axes.
+ * Blocks only until the device reports data ready (typically 7.3ms), then
+ * reads ST1, the data registers and ST2 in one burst.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return 1 on success, 0 on timeout or bus error, -1 if the sample is invalid
+ *         (magnetic overflow or data error); x/y/z are zeroed unless 1
+ * @see getMeasurement()
+ */
+int8_t AK8975::getHeading(int16_t *x, int16_t *y, int16_t *z) {
+    startMeasurement();
+    int8_t result = waitForData() ? getMeasurement(x, y, z) : 0;
+    if (result != 1) *x = *y = *z = 0;
+    return result;
 }
+/** Take a single measurement and return the X axis only.
+ * Every per-axis getter triggers its own conversion, so use getHeading() when
+ * more than one axis is needed.
+ */
 int16_t AK8975::getHeadingX() {
-    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
-    delay(10);
+    startMeasurement();
+    waitForData();
+    measuring = false;
     I2Cdev::readBytes(devAddr, AK8975_RA_HXL, 2, buffer);
     return (((int16_t)buffer[1]) << 8) | buffer[0];
 }
 int16_t AK8975::getHeadingY() {
-    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
-    delay(10);
+    startMeasurement();
+    waitForData();
+    measuring = false;
     I2Cdev::readBytes(devAddr, AK8975_RA_HYL, 2, buffer);
     return (((int16_t)buffer[1]) << 8) | buffer[0];
 }
 int16_t AK8975::getHeadingZ() {
-    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
-    delay(10);
+    startMeasurement();
+    waitForData();
+    measuring = false;
     I2Cdev::readBytes(devAddr, AK8975_RA_HZL, 2, buffer);
     return (((int16_t)buffer[1]) << 8) | buffer[0];
 }
@@ -179,4 +199,79 @@ uint8_t AK8975::getAdjustmentZ() {
 }
 void AK8975::setAdjustmentZ(uint8_t z) {
     I2Cdev::writeByte(devAddr, AK8975_RA_ASAZ, z);
-}
\ No newline at end of file
+}
+
+// non-blocking measurement
+
+/** Use the DRDY pin to detect the end of a measurement.
+ * The pin must already be configured as an input. While it is set, polling
+ * does not generate any bus traffic until the pin goes high.
+ * @param pin Arduino pin connected to DRDY, or -1 to use the ST1 DRDY bit
+ */
+void AK8975::setReadyPin(int8_t pin) {
+    readyPin = pin;
+}
+
+/** Trigger a single measurement without waiting for it.
+ * The device returns to power-down mode by itself when the measurement is
+ * done. Collect the result with pollMeasurement().
+ */
+void AK8975::startMeasurement() {
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
+    measureStart = micros();
+    measuring = true;
+}
+
+/** Read ST1, HXL..HZH and ST2 in one 8-byte burst.
+ * The heading is only written when ST1 reports new data.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return 1 if a new sample was read, 0 if no data is ready, -1 if the sample
+ *         is invalid (magnetic overflow or data error)
+ */
+int8_t AK8975::getMeasurement(int16_t *x, int16_t *y, int16_t *z) {
+    if (I2Cdev::readBytes(devAddr, AK8975_RA_ST1, 8, buffer) != 8) return 0;
+    if (!(buffer[0] & (1 << AK8975_ST1_DRDY_BIT))) return 0;
+    measuring = false;
+    *x = (((int16_t)buffer[2]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[4]) << 8) | buffer[3];
+    *z = (((int16_t)buffer[6]) << 8) | buffer[5];
+    if (buffer[7] & ((1 << AK8975_ST2_HOFL_BIT) | (1 << AK8975_ST2_DERR_BIT))) return -1;
+    return 1;
+}
+
+/** Collect the result of startMeasurement() if it is complete.
+ * Never blocks. No bus traffic is generated until the DRDY pin is high (see
+ * setReadyPin()) or, without the pin, until the maximum measurement time has
+ * passed, so a result normally costs a single burst read.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return 1 if a new sample was read, 0 if not ready yet or no measurement
+ *         was started, -1 if the sample is invalid
+ * @see getMeasurement()
+ */
+int8_t AK8975::pollMeasurement(int16_t *x, int16_t *y, int16_t *z) {
+    if (!measuring) return 0;
+    if (readyPin >= 0) {
+        if (digitalRead(readyPin) != HIGH) return 0;
+    } else if (micros() - measureStart < AK8975_MEASURE_TIME_US) {
+        return 0;
+    }
+    return getMeasurement(x, y, z);
+}
+
+/** Wait for the measurement started by startMeasurement() to complete.
+ * Polls the DRDY pin or the ST1 DRDY bit, starting at the typical
+ * measurement time.
+ * @return True if data is ready, false on timeout
+ */
+bool AK8975::waitForData() {
+    delayMicroseconds(7000);
+    while (micros() - measureStart < 2 * AK8975_MEASURE_TIME_US) {
+        if (readyPin >= 0 ? digitalRead(readyPin) == HIGH : getDataReady()) return true;
+        delayMicroseconds(100);
+    }
+    return false;
+}
@@ -78,6 +78,8 @@ THE SOFTWARE.
 
 #define AK8975_I2CDIS_BIT         0
 
+#define AK8975_MEASURE_TIME_US    9000 // maximum single measurement time
+
 class AK8975 {
     public:
         AK8975();
@@ -96,7 +98,7 @@ class AK8975 {
         bool getDataReady();
         
         // H* registers
-        void getHeading(int16_t *x, int16_t *y, int16_t *z);
+        int8_t getHeading(int16_t *x, int16_t *y, int16_t *z);
         int16_t getHeadingX();
         int16_t getHeadingY();
         int16_t getHeadingZ();
@@ -126,10 +128,21 @@ class AK8975 {
         uint8_t getAdjustmentZ();
         void setAdjustmentZ(uint8_t z);
 
+        // non-blocking measurement
+        void setReadyPin(int8_t pin);
+        void startMeasurement();
+        int8_t getMeasurement(int16_t *x, int16_t *y, int16_t *z);
+        int8_t pollMeasurement(int16_t *x, int16_t *y, int16_t *z);
+
     private:
+        bool waitForData();
+
         uint8_t devAddr;
-        uint8_t buffer[6];
+        uint8_t buffer[8];
         uint8_t mode;
+        int8_t readyPin;
+        bool measuring;
+        uint32_t measureStart;
 };
 
 #endif /* _AK8975_H_ */
\ No newline at end of file
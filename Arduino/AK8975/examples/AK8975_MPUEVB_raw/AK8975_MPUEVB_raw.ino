@@ -61,7 +61,8 @@ THE SOFTWARE.
 // Addr pins high/low = 0x0E (default for InvenSense MPU6050 evaluation board)
 // Addr pins high/high = 0x0F
 AK8975 mag(0x0E);
-MPU6050 accelgyro; // address = 0x68, the default, on MPU6050 EVB
+I2Cdev i2cdev(Wire);
+MPU6050<TwoWire> accelgyro(i2cdev); // address = 0x68, the default, on MPU6050 EVB
 
 int16_t mx, my, mz;
 
@@ -47,6 +47,35 @@ THE SOFTWARE.
 
 #define AT24C32_DEFAULT_ADDRESS      AT24C32_ADDRESS_0
 
+#define AT24C32_SIZE                 4096
+#define AT24C32_PAGE_SIZE            32
+
+// upper bound for one internal write cycle (5 ms typical, 10 ms max at 2.7 V)
+#ifndef AT24C32_WRITE_TIMEOUT_MS
+#define AT24C32_WRITE_TIMEOUT_MS     20
+#endif
+
+// data bytes per write transaction; the Wire buffer also holds the two
+// address bytes, so with the 32-byte AVR buffer a page takes two writes
+#ifndef AT24C32_WRITE_CHUNK
+#if defined(BUFFER_LENGTH) && (BUFFER_LENGTH - 2) < AT24C32_PAGE_SIZE
+#define AT24C32_WRITE_CHUNK          (BUFFER_LENGTH - 2)
+#else
+#define AT24C32_WRITE_CHUNK          AT24C32_PAGE_SIZE
+#endif
+#endif
+
+// bytes per sequential read request (readRaw() takes at most 255)
+#ifndef AT24C32_READ_CHUNK
+#if defined(BUFFER_LENGTH) && BUFFER_LENGTH < 256
+#define AT24C32_READ_CHUNK           BUFFER_LENGTH
+#elif defined(BUFFER_LENGTH)
+#define AT24C32_READ_CHUNK           255
+#else
+#define AT24C32_READ_CHUNK           32
+#endif
+#endif
+
 
 template <typename WIRE>
 class AT24C32 {
@@ -61,7 +90,7 @@ public:
    * @see AT24C32_ADDRESS
    */
   AT24C32(I2CdevT<WIRE, uint16_t>& i2cdev, uint8_t devAddress=AT24C32_DEFAULT_ADDRESS):
-    _i2cdev(i2cdev), _devAddr(devAddress) {
+    _i2cdev(i2cdev), _devAddr(devAddress), _busy(false) {
   }
 
   /** Power on and prepare for general usage.
@@ -97,14 +126,12 @@ public:
    *
    * @param regAddr 12 bit eeprom address
    * @param data the byte to write
-   * @param useBuiltinDelay if true: run delay(1)
+   * @param waitForCompletion if true: ACK-poll until the write cycle is done
    * @return True if the write succeded
+   * @see writeBytes()
    */
-  bool writeByte(uint16_t regAddr, uint8_t data, bool useBuiltinDelay=true) {
-    bool rv = _i2cdev.writeByte(_devAddr, regAddr, data);
-    if (useBuiltinDelay)
-      delay(1);
-    return rv;
+  bool writeByte(uint16_t regAddr, uint8_t data, bool waitForCompletion=true) {
+    return writeBytes(regAddr, 1, &data, waitForCompletion);
   }
   
   /** Read a byte from the eeprom
@@ -113,41 +140,113 @@ public:
    * @return the data
    */
   uint8_t readByte(uint16_t regAddr) {
-    uint8_t buffer;
-    _i2cdev.readByte(_devAddr, regAddr, &buffer);
+    uint8_t buffer = 0;
+    readBytes(regAddr, 1, &buffer);
     return buffer;
   }
   
   /** Write a sequence of bytes to the eeprom
    *
-   * @param regAddr First register address to write to (note: 12 bits)
-   *                Clear the last four bits of the address.
-   * @param length Number of bytes to write (max 30)
+   * The data is split at every 32-byte page boundary (and at
+   * AT24C32_WRITE_CHUNK when the Wire buffer cannot hold a whole page), so
+   * any start address and length are safe; the device would otherwise wrap
+   * around within the page. Between transactions the device is ACK-polled
+   * instead of waiting a fixed delay, so each page costs exactly one internal
+   * write cycle (two with the 32-byte AVR Wire buffer).
+   *
+   * @param regAddr First eeprom address to write to (note: 12 bits)
+   * @param length Number of bytes to write (up to AT24C32_SIZE)
    * @param data Buffer to copy new data from
+   * @param waitForCompletion if false, return as soon as the last page is
+   *        sent; the next access (or waitForWrite()) waits for it instead
    * @return Status of operation (true = success)
    */
-  bool writeBytes(uint16_t regAddr, uint8_t length, uint8_t *data, bool useBuiltinDelay=true) {
-    bool rv = _i2cdev.writeBytes(_devAddr, regAddr, length, data);
-    if (useBuiltinDelay)
-      delay(1);
-    return rv;
+  bool writeBytes(uint16_t regAddr, uint16_t length, uint8_t *data, bool waitForCompletion=true) {
+    regAddr &= AT24C32_SIZE - 1;
+    while (length > 0) {
+      uint8_t chunk = AT24C32_PAGE_SIZE - (regAddr & (AT24C32_PAGE_SIZE - 1));
+      if (chunk > AT24C32_WRITE_CHUNK) chunk = AT24C32_WRITE_CHUNK;
+      if (chunk > length) chunk = length;
+      if (_busy && !waitForWrite()) return false;
+      if (!_i2cdev.writeBytes(_devAddr, regAddr, chunk, data)) return false;
+      _busy = true;
+      regAddr = (regAddr + chunk) & (AT24C32_SIZE - 1);
+      data += chunk;
+      length -= chunk;
+    }
+    return !waitForCompletion || waitForWrite();
   }
 
   /** Read a sequence of bytes from the eeprom
    *
-   * @param regAddr First register address to write to (note: 12 bits).
-   * @param length the number of bytes to read (max 30)
+   * The start address is sent once and the rest is streamed with
+   * current-address reads in AT24C32_READ_CHUNK pieces, relying on the
+   * device's internal address counter (which rolls over from the last byte
+   * to address 0). Any length can be read this way.
+   *
+   * @param regAddr First eeprom address to read from (note: 12 bits).
+   * @param length the number of bytes to read
+   * @param data Buffer to copy new data to
+   * @return Number of bytes read (-1 indicates failure)
+   */
+  int16_t readBytes(uint16_t regAddr, uint16_t length, uint8_t *data) {
+    if (_busy && !waitForWrite()) return -1;
+    // a write without data only loads the address counter
+    if (!_i2cdev.writeBytes(_devAddr, regAddr & (AT24C32_SIZE - 1), 0, data)) return -1;
+    return readNextBytes(length, data);
+  }
+
+  /** Continue a sequential read at the device's address counter
+   *
+   * Only valid directly after readBytes() or another readNextBytes() call;
+   * writes and isReady() move the address counter. Lets a caller scan a
+   * large area with a small buffer without re-sending the address.
+   *
+   * @param length the number of bytes to read
    * @param data Buffer to copy new data to
    * @return Number of bytes read (-1 indicates failure)
    */
-  int8_t readBytes(uint16_t regAddr, uint8_t length, uint8_t *data) {
-    return _i2cdev.readBytes(_devAddr, regAddr, length, data);
+  int16_t readNextBytes(uint16_t length, uint8_t *data) {
+    uint16_t count = 0;
+    while (count < length) {
+      uint8_t chunk = length - count > AT24C32_READ_CHUNK ? AT24C32_READ_CHUNK : length - count;
+      if (_i2cdev.readRaw(_devAddr, chunk, data + count) != chunk) return -1;
+      count += chunk;
+    }
+    return count;
+  }
+
+  /** Check whether the device accepts commands.
+   * The device does not acknowledge its address during an internal write
+   * cycle. The probe is an address-only write, which leaves the address
+   * counter at 0 but starts no write cycle.
+   * @return True if the device acknowledged
+   */
+  bool isReady() {
+    uint8_t dummy;
+    if (!_i2cdev.writeBytes(_devAddr, 0, 0, &dummy)) return false;
+    _busy = false;
+    return true;
+  }
+
+  /** Wait for the current internal write cycle to finish by ACK polling.
+   * Returns as soon as the device acknowledges, typically well before the
+   * 10 ms worst case.
+   * @return True if ready, false after AT24C32_WRITE_TIMEOUT_MS
+   */
+  bool waitForWrite() {
+    uint32_t t1 = millis();
+    while (!isReady()) {
+      if (millis() - t1 >= AT24C32_WRITE_TIMEOUT_MS) return false;
+    }
+    return true;
   }
 
 
 private:
   I2CdevT<WIRE, uint16_t>& _i2cdev;
   uint8_t _devAddr;
+  bool _busy;                 // a write cycle may still be in progress
 };
 
 #endif /* _AT24C32_H_ */
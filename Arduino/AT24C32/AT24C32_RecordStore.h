@@ -0,0 +1,376 @@
+// I2Cdev library collection - AT24C32 log-structured record store
+// Appends sequence-numbered, CRC-checked records page by page around the
+// EEPROM and keeps a RAM index of the latest copy of every record key
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+ */
+
+#ifndef _AT24C32_RECORDSTORE_H_
+#define _AT24C32_RECORDSTORE_H_
+
+#include "AT24C32.h"
+
+// record keys are 0 .. AT24C32_STORE_MAX_KEYS-1
+#ifndef AT24C32_STORE_MAX_KEYS
+#define AT24C32_STORE_MAX_KEYS      16
+#endif
+
+// key, length, sequence (LE), CRC-16 (LE)
+#define AT24C32_STORE_HEADER_SIZE   6
+#define AT24C32_STORE_MAX_PAYLOAD   (AT24C32_PAGE_SIZE - AT24C32_STORE_HEADER_SIZE)
+#define AT24C32_STORE_END           0xFF    // key byte of unused page space
+#define AT24C32_STORE_NONE          0xFFFF  // index entry of a key never written
+
+uint16_t at24c32Crc16(const uint8_t *data, uint8_t length, uint16_t crc=0xFFFF);
+
+template <typename WIRE>
+class AT24C32RecordStore {
+  public:
+        AT24C32RecordStore() = delete;
+        AT24C32RecordStore( const AT24C32RecordStore& other ) = delete; // non construction-copyable
+        AT24C32RecordStore & operator=( const AT24C32RecordStore& ) = delete; // non copyable
+
+        /** Create a record store on a page-aligned EEPROM area.
+         * @param eeprom Device to use, must stay valid for the lifetime of the store
+         * @param start First address of the area (rounded down to a page)
+         * @param pageCount Number of 32-byte pages in the area, more than
+         *        AT24C32_STORE_MAX_KEYS + 1; cut back to the pages left
+         *        before the end of the device
+         */
+        AT24C32RecordStore(AT24C32<WIRE>& eeprom, uint16_t start=0, uint8_t pageCount=AT24C32_SIZE / AT24C32_PAGE_SIZE) :
+                                             eeprom(eeprom),
+                                             start(start & ~(AT24C32_PAGE_SIZE - 1)),
+                                             pageCount(clampPageCount(start, pageCount)),
+                                             head(0),
+                                             fill(0),
+                                             pending(false),
+                                             nextSeq(0),
+                                             pageWrites(0)
+                                             {
+            clearIndex();
+        }
+
+        bool begin();
+        bool format();
+
+        bool write(uint8_t key, const uint8_t *data, uint8_t length);
+        bool sync();
+
+        int8_t read(uint8_t key, uint8_t *data, uint8_t maxLength);
+        bool contains(uint8_t key);
+        uint8_t getLength(uint8_t key);
+        uint16_t getPageWriteCount();
+
+  private:
+        static uint8_t clampPageCount(uint16_t start, uint8_t pageCount);
+        static bool isNewer(uint16_t a, uint16_t b);
+        uint16_t pageAddress(uint8_t p);
+        uint8_t nextPage(uint8_t p);
+        bool isLiveIn(uint8_t key, uint8_t p);
+        void clearIndex();
+        void stage(uint8_t key, const uint8_t *data, uint8_t length);
+        bool commit();
+        bool compactPage(uint8_t p);
+
+        AT24C32<WIRE>& eeprom;
+        uint16_t start;
+        uint8_t pageCount;
+        uint8_t head;               // page the staging buffer is written to
+        uint8_t fill;               // bytes used in the staging buffer
+        bool pending;               // staging buffer holds new (not relocated) records
+        uint16_t nextSeq;
+        uint16_t pageWrites;
+        uint8_t page[AT24C32_PAGE_SIZE];
+        uint16_t offset[AT24C32_STORE_MAX_KEYS];    // address of the latest record
+        uint16_t seq[AT24C32_STORE_MAX_KEYS];
+        uint8_t length[AT24C32_STORE_MAX_KEYS];
+};
+
+/** Limit an area to the end of the device.
+ * Addresses past AT24C32_SIZE would wrap to the start of the EEPROM and
+ * overwrite whatever lives there, so the area ends at the last page instead.
+ * @return Number of pages of the area that fit, 0 if start is past the end
+ */
+template <typename WIRE>
+uint8_t AT24C32RecordStore<WIRE>::clampPageCount(uint16_t start, uint8_t pageCount) {
+    start &= ~(AT24C32_PAGE_SIZE - 1);
+    if (start >= AT24C32_SIZE) return 0;
+    uint16_t fit = (AT24C32_SIZE - start) / AT24C32_PAGE_SIZE;
+    return pageCount < fit ? pageCount : fit;
+}
+
+/** Compare two sequence numbers with wrap-around.
+ * @return True if a was written after b
+ */
+template <typename WIRE>
+bool AT24C32RecordStore<WIRE>::isNewer(uint16_t a, uint16_t b) {
+    return (int16_t)(a - b) > 0;
+}
+
+template <typename WIRE>
+uint16_t AT24C32RecordStore<WIRE>::pageAddress(uint8_t p) {
+    return start + (uint16_t)p * AT24C32_PAGE_SIZE;
+}
+
+template <typename WIRE>
+uint8_t AT24C32RecordStore<WIRE>::nextPage(uint8_t p) {
+    return p + 1 < pageCount ? p + 1 : 0;
+}
+
+template <typename WIRE>
+bool AT24C32RecordStore<WIRE>::isLiveIn(uint8_t key, uint8_t p) {
+    return offset[key] != AT24C32_STORE_NONE && (uint16_t)(offset[key] - pageAddress(p)) < AT24C32_PAGE_SIZE;
+}
+
+template <typename WIRE>
+void AT24C32RecordStore<WIRE>::clearIndex() {
+    for (uint8_t k = 0; k < AT24C32_STORE_MAX_KEYS; k++) offset[k] = AT24C32_STORE_NONE;
+}
+
+/** Build the index from the EEPROM contents.
+ * The area is read in a single sequential stream, one page at a time. Every
+ * record with a valid CRC is considered and the one with the newest sequence
+ * number wins for each key; parsing of a page stops at the first unused or
+ * damaged record. Writing resumes on the page after the newest record. If
+ * that page still holds live records (a page write was interrupted), it is
+ * skipped so that they are not overwritten.
+ *
+ * Use format() once on a new or foreign EEPROM area before the first begin().
+ *
+ * @return True on success, false on a bus error or too small an area
+ */
+template <typename WIRE>
+bool AT24C32RecordStore<WIRE>::begin() {
+    if (pageCount <= AT24C32_STORE_MAX_KEYS + 1) return false;
+    clearIndex();
+    fill = 0;
+    pending = false;
+
+    bool found = false;
+    uint16_t newest = 0;
+    uint8_t newestPage = 0;
+    for (uint8_t p = 0; p < pageCount; p++) {
+        int16_t count = p == 0 ? eeprom.readBytes(pageAddress(0), AT24C32_PAGE_SIZE, page)
+                               : eeprom.readNextBytes(AT24C32_PAGE_SIZE, page);
+        if (count != AT24C32_PAGE_SIZE) return false;
+
+        uint8_t o = 0;
+        while (o + AT24C32_STORE_HEADER_SIZE <= AT24C32_PAGE_SIZE) {
+            uint8_t *r = page + o;
+            uint8_t key = r[0];
+            uint8_t len = r[1];
+            if (key >= AT24C32_STORE_MAX_KEYS || len > AT24C32_PAGE_SIZE - AT24C32_STORE_HEADER_SIZE - o) break;
+            uint16_t crc = at24c32Crc16(r + AT24C32_STORE_HEADER_SIZE, len, at24c32Crc16(r, 4));
+            if (crc != (r[4] | ((uint16_t)r[5] << 8))) break;
+
+            uint16_t s = r[2] | ((uint16_t)r[3] << 8);
+            if (offset[key] == AT24C32_STORE_NONE || isNewer(s, seq[key])) {
+                offset[key] = pageAddress(p) + o;
+                seq[key] = s;
+                length[key] = len;
+            }
+            if (!found || isNewer(s, newest)) {
+                newest = s;
+                newestPage = p;
+                found = true;
+            }
+            o += AT24C32_STORE_HEADER_SIZE + len;
+        }
+    }
+
+    nextSeq = found ? newest + 1 : 0;
+    head = found ? nextPage(newestPage) : 0;
+    for (uint8_t n = 0; n < pageCount; n++) {
+        bool live = false;
+        for (uint8_t k = 0; k < AT24C32_STORE_MAX_KEYS; k++) live |= isLiveIn(k, head);
+        if (!live) break;
+        head = nextPage(head);
+    }
+    return compactPage(nextPage(head));
+}
+
+/** Erase the whole area and empty the index.
+ * Costs one write cycle per page.
+ * @return True on success, false on a bus error or too small an area
+ */
+template <typename WIRE>
+bool AT24C32RecordStore<WIRE>::format() {
+    if (pageCount <= AT24C32_STORE_MAX_KEYS + 1) return false;
+    memset(page, AT24C32_STORE_END, AT24C32_PAGE_SIZE);
+    for (uint8_t p = 0; p < pageCount; p++) {
+        if (!eeprom.writeBytes(pageAddress(p), AT24C32_PAGE_SIZE, page, false)) return false;
+    }
+    clearIndex();
+    head = 0;
+    fill = 0;
+    pending = false;
+    nextSeq = 0;
+    return eeprom.waitForWrite();
+}
+
+/** Append a new value for a key.
+ * The record is added to a one-page RAM staging buffer; the buffer is written
+ * as a single page (see sync()) only when the next record does not fit, so
+ * several small records share one write cycle. The new value is visible to
+ * read() immediately. Nothing is ever rewritten in place: pages are filled in
+ * order around the area, spreading wear evenly over all of them.
+ * @param key Record key (0 .. AT24C32_STORE_MAX_KEYS-1)
+ * @param data Record payload
+ * @param length Payload size, up to AT24C32_STORE_MAX_PAYLOAD bytes
+ * @return True on success
+ */
+template <typename WIRE>
+bool AT24C32RecordStore<WIRE>::write(uint8_t key, const uint8_t *data, uint8_t length) {
+    if (key >= AT24C32_STORE_MAX_KEYS || length > AT24C32_STORE_MAX_PAYLOAD) return false;
+    // a page holding relocated records only may need to be followed by another
+    for (uint8_t n = 0; fill + AT24C32_STORE_HEADER_SIZE + length > AT24C32_PAGE_SIZE; n++) {
+        if (n >= pageCount || !commit()) return false;
+    }
+    stage(key, data, length);
+    pending = true;
+    return true;
+}
+
+/** Write the staging buffer if it holds records not yet on the EEPROM.
+ * Call before power may be lost; the rest of the page is then left unused.
+ * @return True on success
+ */
+template <typename WIRE>
+bool AT24C32RecordStore<WIRE>::sync() {
+    return !pending || commit();
+}
+
+/** Read the latest value of a key.
+ * Takes a single read of the record from the indexed address (or none if it
+ * is still in the staging buffer) and verifies its CRC.
+ * @param key Record key
+ * @param data Buffer for the payload
+ * @param maxLength Size of data
+ * @return Payload length, or -1 if the key is unknown, the buffer is too
+ *         small, or the record cannot be read or fails the CRC check
+ */
+template <typename WIRE>
+int8_t AT24C32RecordStore<WIRE>::read(uint8_t key, uint8_t *data, uint8_t maxLength) {
+    if (!contains(key) || length[key] > maxLength) return -1;
+    uint8_t len = length[key];
+    if (isLiveIn(key, head) && offset[key] - pageAddress(head) < fill) {
+        memcpy(data, page + (offset[key] - pageAddress(head)) + AT24C32_STORE_HEADER_SIZE, len);
+        return len;
+    }
+    uint8_t r[AT24C32_PAGE_SIZE];
+    if (eeprom.readBytes(offset[key], AT24C32_STORE_HEADER_SIZE + len, r) != AT24C32_STORE_HEADER_SIZE + len) return -1;
+    uint16_t crc = at24c32Crc16(r + AT24C32_STORE_HEADER_SIZE, len, at24c32Crc16(r, 4));
+    if (r[0] != key || crc != (r[4] | ((uint16_t)r[5] << 8))) return -1;
+    memcpy(data, r + AT24C32_STORE_HEADER_SIZE, len);
+    return len;
+}
+
+/** Check whether a key has a value.
+ * @param key Record key
+ * @return True if the key was written since the last format()
+ */
+template <typename WIRE>
+bool AT24C32RecordStore<WIRE>::contains(uint8_t key) {
+    return key < AT24C32_STORE_MAX_KEYS && offset[key] != AT24C32_STORE_NONE;
+}
+
+/** Get the payload length of the latest value of a key.
+ * @param key Record key
+ * @return Payload length, 0 if the key has no value
+ */
+template <typename WIRE>
+uint8_t AT24C32RecordStore<WIRE>::getLength(uint8_t key) {
+    return contains(key) ? length[key] : 0;
+}
+
+/** Get the number of page writes since begin() or format().
+ * @return EEPROM write cycles spent on the log
+ */
+template <typename WIRE>
+uint16_t AT24C32RecordStore<WIRE>::getPageWriteCount() {
+    return pageWrites;
+}
+
+/** Add a record to the staging buffer and point the index at it.
+ * The caller makes sure it fits.
+ */
+template <typename WIRE>
+void AT24C32RecordStore<WIRE>::stage(uint8_t key, const uint8_t *data, uint8_t length) {
+    uint8_t *r = page + fill;
+    r[0] = key;
+    r[1] = length;
+    r[2] = (uint8_t)nextSeq;
+    r[3] = nextSeq >> 8;
+    memcpy(r + AT24C32_STORE_HEADER_SIZE, data, length);
+    uint16_t crc = at24c32Crc16(r + AT24C32_STORE_HEADER_SIZE, length, at24c32Crc16(r, 4));
+    r[4] = (uint8_t)crc;
+    r[5] = crc >> 8;
+
+    offset[key] = pageAddress(head) + fill;
+    seq[key] = nextSeq++;
+    this->length[key] = length;
+    fill += AT24C32_STORE_HEADER_SIZE + length;
+}
+
+/** Write the staging buffer to the head page and move on to the next page.
+ * The write cycle is left to finish in the background; the next access to
+ * the EEPROM waits for it.
+ */
+template <typename WIRE>
+bool AT24C32RecordStore<WIRE>::commit() {
+    memset(page + fill, AT24C32_STORE_END, AT24C32_PAGE_SIZE - fill);
+    if (!eeprom.writeBytes(pageAddress(head), AT24C32_PAGE_SIZE, page, false)) return false;
+    pageWrites++;
+    head = nextPage(head);
+    fill = 0;
+    pending = false;
+    return compactPage(nextPage(head));
+}
+
+/** Compaction: move the live records of a page into the staging buffer.
+ * Called for the page after the head whenever the head advances, so that it
+ * holds no live records by the time the log reaches it and can be
+ * overwritten. The old copies stay valid on the EEPROM until then, so an
+ * interrupted page write never loses the only copy of a record. The staging
+ * buffer is empty at this point and one page worth of records always fits.
+ * @param p Page to reclaim
+ */
+template <typename WIRE>
+bool AT24C32RecordStore<WIRE>::compactPage(uint8_t p) {
+    bool live = false;
+    for (uint8_t k = 0; k < AT24C32_STORE_MAX_KEYS; k++) live |= isLiveIn(k, p);
+    if (!live) return true;
+
+    uint8_t old[AT24C32_PAGE_SIZE];
+    if (eeprom.readBytes(pageAddress(p), AT24C32_PAGE_SIZE, old) != AT24C32_PAGE_SIZE) return false;
+    for (uint8_t k = 0; k < AT24C32_STORE_MAX_KEYS; k++) {
+        if (isLiveIn(k, p)) stage(k, old + (offset[k] - pageAddress(p)) + AT24C32_STORE_HEADER_SIZE, length[k]);
+    }
+    return true;
+}
+
+#endif /* _AT24C32_RECORDSTORE_H_ */
@@ -37,6 +37,7 @@ THE SOFTWARE.
  */
 BMA150::BMA150() {
     devAddr = BMA150_DEFAULT_ADDRESS;
+    shadowValid = false;
 }
 
 /** Specific address constructor.
@@ -46,6 +47,7 @@ BMA150::BMA150() {
  */
 BMA150::BMA150(uint8_t address) {
     devAddr = address;
+    shadowValid = false;
 }
 
 /** Power on and prepare for general usage. This sets the full scale range of 
@@ -101,6 +103,28 @@ void BMA150::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
     *z = ((((int16_t)buffer[5]) << 8) | buffer[4]) >> 6;
 }
 
+/** Get 3-axis accelerometer readings and their new-data flags in one burst.
+ * The new_data bit of each axis sits in bit 0 of its LSB register and is
+ * cleared by reading that axis, so the 6-byte burst returns the flags of the
+ * values it read. With shadowing enabled (see setShadowDis()) the MSBs are
+ * locked by the LSB reads, so all axes come from consistent conversions.
+ * @param x 16-bit signed integer container for X-axis acceleration
+ * @param y 16-bit signed integer container for Y-axis acceleration
+ * @param z 16-bit signed integer container for Z-axis acceleration
+ * @return Bitmask of axes that held new data
+ * @see BMA150_NEW_DATA_X
+ * @see BMA150_RA_X_AXIS_LSB
+ */
+uint8_t BMA150::getAccelerationNewData(int16_t* x, int16_t* y, int16_t* z) {
+    I2Cdev::readBytes(devAddr, BMA150_RA_X_AXIS_LSB, 6, buffer);
+    *x = ((((int16_t)buffer[1]) << 8) | buffer[0]) >> 6;
+    *y = ((((int16_t)buffer[3]) << 8) | buffer[2]) >> 6;
+    *z = ((((int16_t)buffer[5]) << 8) | buffer[4]) >> 6;
+    return ((buffer[0] >> BMA150_X_NEW_DATA_BIT) & 1)
+         | (((buffer[2] >> BMA150_Y_NEW_DATA_BIT) & 1) << 1)
+         | (((buffer[4] >> BMA150_Z_NEW_DATA_BIT) & 1) << 2);
+}
+
 /** Get X-axis accelerometer reading.
  * @return X-axis acceleration measurement in 16-bit 2's complement format
  * @see BMA150_RA_X_AXIS_LSB
@@ -547,4 +571,80 @@ uint8_t BMA150::getBandwidth() {
  */
 void BMA150::setBandwidth(uint8_t bandwidth) {
     I2Cdev::writeBits(devAddr, BMA150_RA_RANGE_BWIDTH, BMA150_BANDWIDTH_BIT, BMA150_BANDWIDTH_LENGTH, bandwidth);
-}
\ No newline at end of file
+}
+
+// configuration snapshot
+
+/** Read all configuration registers in one burst.
+ * Reads SMB150_CONF1 through OFFSET_T (19 bytes) and keeps a copy, so that a
+ * following applyConfig() only writes what was changed. Individual setters
+ * bypass that copy; call this again after using them.
+ * @param config Container for the register values
+ * @return True on success
+ * @see BMA150Config
+ */
+bool BMA150::getConfig(BMA150Config *config) {
+    if (I2Cdev::readBytes(devAddr, BMA150_RA_SMB150_CONF1, BMA150_CONFIG_LENGTH, (uint8_t *)config) != BMA150_CONFIG_LENGTH) {
+        shadowValid = false;
+        return false;
+    }
+    shadow = *config;
+    shadowValid = true;
+    return true;
+}
+
+/** Write a configuration back to the device.
+ * Only registers that differ from the last getConfig() or applyConfig() are
+ * written, one single-byte write each, since the datasheet does not define
+ * address auto-increment for I2C writes. The offset and gain image registers
+ * are write-protected: if any of them changed, EEW is set for the duration of
+ * those writes and cleared again afterwards. Without a previous snapshot every
+ * register is written.
+ * @param config Register values to apply
+ * @return Number of registers written
+ * @see getConfig()
+ * @see setEEW()
+ */
+uint8_t BMA150::applyConfig(const BMA150Config *config) {
+    const uint8_t *next = (const uint8_t *)config;
+    const uint8_t *last = (const uint8_t *)&shadow;
+    uint8_t written = 0;
+    bool eew = false;
+
+    for (uint8_t i = 0; i < BMA150_CONFIG_LENGTH; i++) {
+        if (shadowValid && next[i] == last[i]) continue;
+        if (i >= BMA150_CONFIG_IMAGE_START && !eew) {
+            setEEW(true);
+            eew = true;
+        }
+        I2Cdev::writeByte(devAddr, BMA150_RA_SMB150_CONF1 + i, next[i]);
+        written++;
+    }
+    if (eew) setEEW(false);
+
+    shadow = *config;
+    shadowValid = true;
+    return written;
+}
+
+/** Change a bit field in a register value of a configuration snapshot.
+ * Uses the same bit numbering as the BMA150_*_BIT and _LENGTH definitions.
+ * @param reg Register value to modify (e.g. &config.rangeBandwidth)
+ * @param bitStart First bit position to write (0-7)
+ * @param length Number of bits to write
+ * @param value Right-aligned value to write
+ */
+void BMA150::setConfigBits(uint8_t *reg, uint8_t bitStart, uint8_t length, uint8_t value) {
+    uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+    *reg = (*reg & ~mask) | ((value << (bitStart - length + 1)) & mask);
+}
+
+/** Extract a bit field from a register value of a configuration snapshot.
+ * @param reg Register value (e.g. config.rangeBandwidth)
+ * @param bitStart First bit position to read (0-7)
+ * @param length Number of bits to read
+ * @return Right-aligned field value
+ */
+uint8_t BMA150::getConfigBits(uint8_t reg, uint8_t bitStart, uint8_t length) {
+    return (reg >> (bitStart - length + 1)) & ((1 << length) - 1);
+}
@@ -147,6 +147,35 @@ THE SOFTWARE.
 #define BMA150_MODE_NORMAL             0
 #define BMA150_MODE_SLEEP              1
 
+/* new data flags returned by getAccelerationNewData() */
+#define BMA150_NEW_DATA_X              0x01
+#define BMA150_NEW_DATA_Y              0x02
+#define BMA150_NEW_DATA_Z              0x04
+
+/* configuration snapshot, image registers need EEW set to be written */
+#define BMA150_CONFIG_LENGTH           19
+#define BMA150_CONFIG_IMAGE_START      11
+
+/** Copy of the configuration registers SMB150_CONF1 (0x0B) to OFFSET_T (0x1D),
+ * in register order. Use the BMA150_*_BIT and _LENGTH definitions with
+ * BMA150::setConfigBits() to change individual fields.
+ */
+struct BMA150Config {
+    uint8_t conf1;              // 0x0B
+    uint8_t lgThreshold;        // 0x0C
+    uint8_t lgDuration;         // 0x0D
+    uint8_t hgThreshold;        // 0x0E
+    uint8_t hgDuration;         // 0x0F
+    uint8_t motionThreshold;    // 0x10
+    uint8_t hysteresis;         // 0x11
+    uint8_t customer1;          // 0x12
+    uint8_t customer2;          // 0x13
+    uint8_t rangeBandwidth;     // 0x14, bits 7-5 are reserved and kept as read
+    uint8_t conf2;              // 0x15
+    uint8_t offsGain[4];        // 0x16-0x19 image registers (X, Y, Z, T)
+    uint8_t offset[4];          // 0x1A-0x1D image registers (X, Y, Z, T)
+};
+
 class BMA150 {
     public:
         BMA150();
@@ -163,6 +192,7 @@ class BMA150 {
         
         // AXIS registers
         void getAcceleration(int16_t* x, int16_t* y, int16_t* z);
+        uint8_t getAccelerationNewData(int16_t* x, int16_t* y, int16_t* z);
         int16_t getAccelerationX();
         int16_t getAccelerationY();
         int16_t getAccelerationZ();
@@ -270,11 +300,19 @@ class BMA150 {
         // OFFS_GAIN registers
         
         // OFFSET registers
+
+        // configuration snapshot
+        bool getConfig(BMA150Config *config);
+        uint8_t applyConfig(const BMA150Config *config);
+        static void setConfigBits(uint8_t *reg, uint8_t bitStart, uint8_t length, uint8_t value);
+        static uint8_t getConfigBits(uint8_t reg, uint8_t bitStart, uint8_t length);
         
         private:
         uint8_t devAddr;
         uint8_t buffer[6];
         uint8_t mode;
+        BMA150Config shadow;
+        bool shadowValid;
 };
 
 #endif /* _BMA150_H_ */
\ No newline at end of file
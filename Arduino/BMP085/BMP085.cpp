@@ -33,12 +33,41 @@ THE SOFTWARE.
 #include "BMP085.h"
 #include <math.h>
 
+#ifdef __AVR__
+    #include <avr/pgmspace.h>
+#else
+    #ifndef PROGMEM
+        #define PROGMEM
+    #endif
+    #ifndef pgm_read_dword
+        #define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+    #endif
+#endif
+
+// Altitude in cm for pressure / sea-level-pressure ratios 0.25 to 1.25 in
+// steps of 1/64, from h = 44330 * (1 - (p / p0)^0.1903)
+static const int32_t bmp085AltitudeTable[65] PROGMEM = {
+    1027933, 988421, 950749, 914735, 880225, 847085, 815199, 784465,
+    754795, 726110, 698340, 671421, 645298, 619919, 595240, 571217,
+    547815, 524997, 502732, 480992, 459749, 438978, 418657, 398764,
+    379280, 360187, 341467, 323105, 305085, 287394, 270018, 252946,
+    236165, 219665, 203435, 187466, 171749, 156274, 141035, 126022,
+    111228, 96647, 82271, 68095, 54112, 40316, 26702, 13265,
+    0, -13099, -26035, -38814, -51439, -63915, -76245, -88433,
+    -100484, -112399, -124183, -135839, -147369, -158778, -170067, -181239,
+    -192298
+};
+
 /**
  * Default constructor, uses default I2C device address.
  * @see BMP085_DEFAULT_ADDRESS
  */
 BMP085::BMP085() {
     devAddr = BMP085_DEFAULT_ADDRESS;
+    state = BMP085_STATE_IDLE;
+    ready = false;
+    b5Valid = false;
+    temperatureInterval = 1;
 }
 
 /**
@@ -48,6 +77,10 @@ BMP085::BMP085() {
  */
 BMP085::BMP085(uint8_t address) {
     devAddr = address;
+    state = BMP085_STATE_IDLE;
+    ready = false;
+    b5Valid = false;
+    temperatureInterval = 1;
 }
 
 /**
@@ -207,12 +240,9 @@ float BMP085::getTemperatureC() {
         B5 = X1 + X2
         T = (B5 + 8) / 2^4
     */
-    int32_t ut = getRawTemperature();
-    if(ut == 0) return NAN;
-    int32_t x1 = ((ut - (int32_t)ac6) * (int32_t)ac5) >> 15;
-    int32_t x2 = ((int32_t)mc << 11) / (x1 + md);
-    b5 = x1 + x2;
-    return (float)((b5 + 8) >> 4) / 10.0f;
+    int16_t t = getTemperatureDeciC();
+    if (t == BMP085_TEMPERATURE_INVALID) return NAN;
+    return (float)t / 10.0f;
 }
 
 float BMP085::getTemperatureF() {
@@ -245,8 +275,45 @@ float BMP085::getPressure() {
         X2 = (-7357 * p) / 2^16
         p = p + (X1 + X2 + 3791) / 2^4
     */
+    int32_t p = getPressurePa();
+    if (p == 0) return NAN;
+    return p;
+}
+
+float BMP085::getAltitude(float pressure, float seaLevelPressure) {
+    return 44330 * (1.0 - pow(pressure / seaLevelPressure, 0.1903));
+}
+
+/* integer-only methods */
+
+/**
+ * Read the temperature and update the cached B5 compensation term.
+ * Uses the datasheet's integer algorithm (see getTemperatureC()). The cached
+ * B5 is what getPressurePa() compensates with, so a temperature reading only
+ * needs to be repeated as often as the temperature actually changes.
+ * @return Temperature in 0.1 degrees Celsius, or BMP085_TEMPERATURE_INVALID
+ *         if the last conversion was not a temperature conversion
+ */
+int16_t BMP085::getTemperatureDeciC() {
+    int32_t ut = getRawTemperature();
+    if (ut == 0) return BMP085_TEMPERATURE_INVALID;
+    int32_t x1 = ((ut - (int32_t)ac6) * (int32_t)ac5) >> 15;
+    int32_t x2 = ((int32_t)mc << 11) / (x1 + md);
+    b5 = x1 + x2;
+    b5Valid = true;
+    return (b5 + 8) >> 4;
+}
+
+/**
+ * Read the pressure and compensate it with the cached B5.
+ * Pure 32-bit integer datasheet algorithm (see getPressure()); B5 comes from
+ * the most recent getTemperatureDeciC() or getTemperatureC() call.
+ * @return Pressure in Pascals, or 0 if the last conversion was not a pressure
+ *         conversion
+ */
+int32_t BMP085::getPressurePa() {
     uint32_t up = getRawPressure();
-    if(up == 0) return NAN;
+    if(up == 0) return 0;
     uint8_t oss = (measureMode & 0xC0) >> 6;
     int32_t p;
     int32_t b6 = b5 - 4000;
@@ -270,6 +337,166 @@ float BMP085::getPressure() {
     return p + ((x1 + x2 + (int32_t)3791) >> 4);
 }
 
-float BMP085::getAltitude(float pressure, float seaLevelPressure) {
-    return 44330 * (1.0 - pow(pressure / seaLevelPressure, 0.1903));
+/**
+ * Calculate altitude without floating point.
+ * Linear interpolation in a 65-entry table of the barometric formula over the
+ * pressure ratio p / p0, which is computed with 16 fractional bits. The error
+ * against getAltitude() stays below 0.5 m for ratios 0.8 to 1.05 (about
+ * -400 m to 1850 m), below 1 m for 0.5 to 1.1 and below 3 m over the full
+ * 0.25 to 1.25 table range (about -1900 m to 10300 m); results outside that
+ * range are clamped.
+ * @param pressure Pressure in Pascals
+ * @param seaLevelPressure Sea level pressure in Pascals
+ * @return Altitude in centimeters
+ */
+int32_t BMP085::getAltitudeCm(int32_t pressure, int32_t seaLevelPressure) {
+    if (pressure <= 0 || seaLevelPressure <= 0) return 0;
+    // Q16 ratio from two divisions so nothing overflows 32 bits
+    uint32_t q = ((uint32_t)pressure << 8) / (uint32_t)seaLevelPressure;
+    uint32_t rem = ((uint32_t)pressure << 8) % (uint32_t)seaLevelPressure;
+    uint32_t r = (q << 8) + (rem << 8) / (uint32_t)seaLevelPressure;
+    if (r < 16384) r = 16384;
+    if (r > 16384 + (64UL << 10) - 1) r = 16384 + (64UL << 10) - 1;
+    r -= 16384;
+    uint8_t i = r >> 10;
+    int32_t h0 = pgm_read_dword(&bmp085AltitudeTable[i]);
+    int32_t h1 = pgm_read_dword(&bmp085AltitudeTable[i + 1]);
+    return h0 + (((h1 - h0) * (int32_t)(r & 1023)) >> 10);
+}
+
+/* non-blocking measurement methods */
+
+/**
+ * Start a temperature + pressure measurement without blocking.
+ * The temperature conversion is started right away; poll() then moves on to
+ * the pressure conversion and the compensation as each conversion window
+ * elapses, returning to the caller in between. This replaces the blocking
+ * setControl() / wait / read sequence of up to 30 ms with a few short bus
+ * transactions spread over successive poll() calls.
+ * @param pressureMode Pressure oversampling mode (BMP085_MODE_PRESSURE_0..3)
+ * @param continuous Start the next measurement as soon as one is complete
+ * @see poll()
+ * @see BMP085_MODE_PRESSURE_3
+ */
+void BMP085::startMeasurement(uint8_t pressureMode, bool continuous) {
+    this->pressureMode = pressureMode;
+    this->continuous = continuous;
+    ready = false;
+    pressureCount = 0;
+    setControl(BMP085_MODE_TEMPERATURE);
+    conversionStart = micros();
+    state = BMP085_STATE_TEMPERATURE;
+}
+
+/**
+ * Stop the measurement sequence.
+ * A conversion already running in the device completes but is not read.
+ */
+void BMP085::stopMeasurement() {
+    state = BMP085_STATE_IDLE;
+}
+
+/**
+ * Set how often the measurement sequence refreshes the temperature.
+ * Temperature changes slowly, so in continuous mode the cached B5 can be
+ * reused for several pressure conversions, skipping the 4.5 ms temperature
+ * phase and roughly doubling the pressure rate at low oversampling settings.
+ * @param interval Pressure measurements per temperature measurement (1 = every
+ *        measurement, the default)
+ */
+void BMP085::setTemperatureInterval(uint8_t interval) {
+    temperatureInterval = interval ? interval : 1;
+}
+
+/**
+ * Advance the measurement state machine.
+ * Call this regularly (e.g. once per loop iteration). It only touches the bus
+ * when the current conversion window has elapsed, so a call normally returns
+ * within microseconds.
+ * @return True if a new temperature/pressure pair has just become available
+ * @see getLastTemperatureC()
+ * @see getLastPressure()
+ */
+bool BMP085::poll() {
+    if (state == BMP085_STATE_IDLE) return false;
+    if (micros() - conversionStart < getMeasureDelayMicroseconds()) return false;
+
+    if (state == BMP085_STATE_TEMPERATURE) {
+        // also refreshes b5 for the pressure compensation
+        lastTemperature = getTemperatureDeciC();
+        setControl(pressureMode);
+        conversionStart = micros();
+        state = BMP085_STATE_PRESSURE;
+        return false;
+    }
+
+    lastPressure = getPressurePa();
+    ready = true;
+    if (continuous) {
+        if (++pressureCount >= temperatureInterval || !b5Valid) {
+            pressureCount = 0;
+            setControl(BMP085_MODE_TEMPERATURE);
+            state = BMP085_STATE_TEMPERATURE;
+        } else {
+            setControl(pressureMode);
+        }
+        conversionStart = micros();
+    } else {
+        state = BMP085_STATE_IDLE;
+    }
+    return true;
+}
+
+/**
+ * Check whether a measurement result is available.
+ * Set when poll() completes a measurement, cleared by startMeasurement().
+ * In continuous mode it stays set and the values are refreshed in place.
+ * @return True if getLastTemperatureC() and getLastPressure() are valid
+ */
+bool BMP085::isReady() {
+    return ready;
+}
+
+/**
+ * Get the current state of the measurement state machine.
+ * @return BMP085_STATE_IDLE, BMP085_STATE_TEMPERATURE or BMP085_STATE_PRESSURE
+ */
+uint8_t BMP085::getState() {
+    return state;
+}
+
+/**
+ * Get the temperature of the last completed measurement.
+ * @return Temperature in degrees Celsius
+ * @see isReady()
+ */
+float BMP085::getLastTemperatureC() {
+    return (float)lastTemperature / 10.0f;
+}
+
+/**
+ * Get the pressure of the last completed measurement.
+ * @return Pressure in Pascals
+ * @see isReady()
+ */
+float BMP085::getLastPressure() {
+    return lastPressure;
+}
+
+/**
+ * Get the temperature of the last completed measurement.
+ * @return Temperature in 0.1 degrees Celsius
+ * @see isReady()
+ */
+int16_t BMP085::getLastTemperatureDeciC() {
+    return lastTemperature;
+}
+
+/**
+ * Get the pressure of the last completed measurement.
+ * @return Pressure in Pascals
+ * @see isReady()
+ */
+int32_t BMP085::getLastPressurePa() {
+    return lastPressure;
 }
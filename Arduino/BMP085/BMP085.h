@@ -72,6 +72,12 @@ THE SOFTWARE.
 #define BMP085_MODE_PRESSURE_2      0xB4
 #define BMP085_MODE_PRESSURE_3      0xF4
 
+#define BMP085_STATE_IDLE           0
+#define BMP085_STATE_TEMPERATURE    1
+#define BMP085_STATE_PRESSURE       2
+
+#define BMP085_TEMPERATURE_INVALID  -32768
+
 class BMP085 {
     public:
         BMP085();
@@ -114,6 +120,23 @@ class BMP085 {
         float       getPressure();
         float       getAltitude(float pressure, float seaLevelPressure=101325);
 
+        // integer-only methods
+        int16_t     getTemperatureDeciC();
+        int32_t     getPressurePa();
+        int32_t     getAltitudeCm(int32_t pressure, int32_t seaLevelPressure=101325);
+
+        // non-blocking measurement methods
+        void        startMeasurement(uint8_t pressureMode=BMP085_MODE_PRESSURE_3, bool continuous=false);
+        void        stopMeasurement();
+        void        setTemperatureInterval(uint8_t interval);
+        bool        poll();
+        bool        isReady();
+        uint8_t     getState();
+        float       getLastTemperatureC();
+        float       getLastPressure();
+        int16_t     getLastTemperatureDeciC();
+        int32_t     getLastPressurePa();
+
    private:
         uint8_t devAddr;
         uint8_t buffer[3];
@@ -122,7 +145,18 @@ class BMP085 {
         int16_t ac1, ac2, ac3, b1, b2, mb, mc, md;
         uint16_t ac4, ac5, ac6;
         int32_t b5;
+        bool b5Valid;
         uint8_t measureMode;
+
+        uint8_t state;
+        uint8_t pressureMode;
+        bool continuous;
+        bool ready;
+        uint32_t conversionStart;
+        uint8_t temperatureInterval;
+        uint8_t pressureCount;
+        int16_t lastTemperature;
+        int32_t lastPressure;
 };
 
 #endif /* _BMP085_H_ */
@@ -197,10 +197,10 @@ class DS1307 {
         void getTime24(uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
         void setTime24(uint8_t hours, uint8_t minutes, uint8_t seconds);
         
-        void getDateTime12(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds, uint8_t *ampm);
+        bool getDateTime12(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds, uint8_t *ampm);
         void setDateTime12(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t ampm);
         
-        void getDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
+        bool getDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
         void setDateTime24(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds);
         
         #ifdef DS1307_INCLUDE_DATETIME_METHODS
@@ -211,9 +211,13 @@ class DS1307 {
     private:
         I2CdevT<WIRE, uint8_t>& _i2cdev;
         uint8_t devAddr;
-        uint8_t buffer[1];
+        uint8_t buffer[7];
         bool mode12;
         bool clockHalt;
+
+        bool readClock();
+        static uint8_t fromBCD(uint8_t value);
+        static uint8_t decodeHours24(uint8_t value);
 };
 
 
@@ -223,7 +227,7 @@ class DS1307 {
  * @see DS1307_ADDRESS
  */
 template <typename WIRE>
-DS1307<WIRE>::DS1307(I2CdevT<WIRE, uint8_t>& i2cdev, uint8_t address=DS1307_DEFAULT_ADDRESS):_i2cdev(i2cdev) {
+DS1307<WIRE>::DS1307(I2CdevT<WIRE, uint8_t>& i2cdev, uint8_t address):_i2cdev(i2cdev) {
     devAddr = address;
 }
 
@@ -360,13 +364,22 @@ template <typename WIRE>
 uint8_t DS1307<WIRE>::getHours24() {
     _i2cdev.readByte(devAddr, DS1307_RA_HOURS, buffer);
     mode12 = buffer[0] & 0x40;
-    if (mode12) {
+    return decodeHours24(buffer[0]);
+}
+
+/** Decode a HOURS register value in either mode to 0-23.
+ * @param value Raw HOURS register
+ * @return Hours in 24-hour format
+ */
+template <typename WIRE>
+uint8_t DS1307<WIRE>::decodeHours24(uint8_t value) {
+    if (value & 0x40) {
         // bit 6 is high, 12-hour mode
         // Byte: [5 = AM/PM] [4 = 10HR] [3:0 = 1HR]
-        uint8_t hours = (buffer[0] & 0x0F) + ((buffer[0] & 0x10) >> 4) * 10;
+        uint8_t hours = (value & 0x0F) + ((value & 0x10) >> 4) * 10;
 
         // convert 12-hour to 24-hour format, since that's what's requested
-        if (buffer[0] & 0x20) {
+        if (value & 0x20) {
             // currently PM
             if (hours < 12) hours += 12;
         } else {
@@ -377,7 +390,7 @@ uint8_t DS1307<WIRE>::getHours24() {
     } else {
         // bit 6 is low, 24-hour mode (default)
         // Byte: [5:4 = 10HR] [3:0 = 1HR]
-        return (buffer[0] & 0x0F) + ((buffer[0] & 0x30) >> 4) * 10;
+        return (value & 0x0F) + ((value & 0x30) >> 4) * 10;
     }
 }
 
@@ -507,11 +520,31 @@ void DS1307<WIRE>::setMemoryByte(uint8_t offset, uint8_t value) {
 }
 
 // convenience methods
+
+/** Read SECONDS through YEAR in a single 7-byte burst.
+ * The DS1307 copies its counters to a secondary register set on every I2C
+ * START and serves the whole read from that copy, so a burst is consistent
+ * even across a rollover. Separate register reads are not (e.g. 10:59:59
+ * followed by a minutes read after the rollover gives 11:59:59).
+ * @return True on success
+ */
+template <typename WIRE>
+bool DS1307<WIRE>::readClock() {
+    if (_i2cdev.readBytes(devAddr, DS1307_RA_SECONDS, 7, buffer) != 7) return false;
+    clockHalt = buffer[0] & 0x80;
+    mode12 = buffer[2] & 0x40;
+    return true;
+}
+
+template <typename WIRE>
+uint8_t DS1307<WIRE>::fromBCD(uint8_t value) {
+    return (value & 0x0F) + (value >> 4) * 10;
+}
+
 template <typename WIRE>
 void DS1307<WIRE>::getDate(uint16_t *year, uint8_t *month, uint8_t *day) {
-    *year = getYear();
-    *month = getMonth();
-    *day = getDay();
+    uint8_t hours, minutes, seconds;
+    getDateTime24(year, month, day, &hours, &minutes, &seconds);
 }
 template <typename WIRE>
 void DS1307<WIRE>::setDate(uint16_t year, uint8_t month, uint8_t day) {
@@ -522,10 +555,9 @@ void DS1307<WIRE>::setDate(uint16_t year, uint8_t month, uint8_t day) {
 
 template <typename WIRE>
 void DS1307<WIRE>::getTime12(uint8_t *hours, uint8_t *minutes, uint8_t *seconds, uint8_t *ampm) {
-    *hours = getHours12();
-    *minutes = getMinutes();
-    *seconds = getSeconds();
-    *ampm = getAMPM();
+    uint16_t year;
+    uint8_t month, day;
+    getDateTime12(&year, &month, &day, hours, minutes, seconds, ampm);
 }
 
 template <typename WIRE>
@@ -539,9 +571,9 @@ void DS1307<WIRE>::setTime12(uint8_t hours, uint8_t minutes, uint8_t seconds, ui
 
 template <typename WIRE>
 void DS1307<WIRE>::getTime24(uint8_t *hours, uint8_t *minutes, uint8_t *seconds) {
-    *hours = getHours24();
-    *minutes = getMinutes();
-    *seconds = getSeconds();
+    uint16_t year;
+    uint8_t month, day;
+    getDateTime24(&year, &month, &day, hours, minutes, seconds);
 }
 
 template <typename WIRE>
@@ -553,10 +585,17 @@ void DS1307<WIRE>::setTime24(uint8_t hours, uint8_t minutes, uint8_t seconds) {
     setHours24(hours);
 }
 
+/** Read date and time (12-hour format) in one atomic burst.
+ * @return True on success, outputs are unchanged otherwise
+ * @see readClock()
+ */
 template <typename WIRE>
-void DS1307<WIRE>::getDateTime12(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds, uint8_t *ampm) {
-    getTime12(hours, minutes, seconds, ampm);
-    getDate(year, month, day);
+bool DS1307<WIRE>::getDateTime12(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds, uint8_t *ampm) {
+    uint8_t hours24;
+    if (!getDateTime24(year, month, day, &hours24, minutes, seconds)) return false;
+    *ampm = hours24 >= 12;
+    *hours = hours24 % 12 == 0 ? 12 : hours24 % 12;
+    return true;
 }
 
 template <typename WIRE>
@@ -565,10 +604,22 @@ void DS1307<WIRE>::setDateTime12(uint16_t year, uint8_t month, uint8_t day, uint
     setDate(year, month, day);
 }
 
+/** Read date and time (24-hour format) in one atomic burst.
+ * All fields come from the same instant and are decoded in one pass over
+ * the 7-byte SECONDS..YEAR burst.
+ * @return True on success, outputs are unchanged otherwise
+ * @see readClock()
+ */
 template <typename WIRE>
-void DS1307<WIRE>::getDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds) {
-    getTime24(hours, minutes, seconds);
-    getDate(year, month, day);
+bool DS1307<WIRE>::getDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds) {
+    if (!readClock()) return false;
+    *seconds = fromBCD(buffer[0] & 0x7F);
+    *minutes = fromBCD(buffer[1] & 0x7F);
+    *hours = decodeHours24(buffer[2]);
+    *day = fromBCD(buffer[4] & 0x3F);
+    *month = fromBCD(buffer[5] & 0x1F);
+    *year = 2000 + fromBCD(buffer[6]);
+    return true;
 }
 
 template <typename WIRE>
@@ -580,7 +631,10 @@ void DS1307<WIRE>::setDateTime24(uint16_t year, uint8_t month, uint8_t day, uint
 #ifdef DS1307_INCLUDE_DATETIME_METHODS
     template <typename WIRE>
     DateTime DS1307<WIRE>::getDateTime() {
-        DateTime dt = DateTime(getYear(), getMonth(), getDay(), getHours24(), getMinutes(), getSeconds());
+        uint16_t year = 2000;
+        uint8_t month = 1, day = 1, hours = 0, minutes = 0, seconds = 0;
+        getDateTime24(&year, &month, &day, &hours, &minutes, &seconds);
+        DateTime dt = DateTime(year, month, day, hours, minutes, seconds);
         return dt;
     }
 
@@ -0,0 +1,267 @@
+// I2Cdev library collection - DS1307 software clock
+// Extrapolates the RTC time with millis() and re-anchors it on the 1 Hz
+// square wave edge or periodically, so reading the time costs no bus traffic
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _DS1307_CLOCK_H_
+#define _DS1307_CLOCK_H_
+
+#include "DS1307.h"
+
+#ifdef DS1307_INCLUDE_DATETIME_METHODS
+
+// seconds between RTC reads that check the extrapolated time
+#ifndef DS1307_CLOCK_RESYNC_INTERVAL
+#define DS1307_CLOCK_RESYNC_INTERVAL    60
+#endif
+
+// SECONDS register poll period while waiting for a rollover
+#ifndef DS1307_CLOCK_POLL_MS
+#define DS1307_CLOCK_POLL_MS            10
+#endif
+
+template <typename WIRE>
+class DS1307Clock {
+  public:
+        DS1307Clock() = delete;
+        DS1307Clock( const DS1307Clock& other ) = delete; // non construction-copyable
+        DS1307Clock & operator=( const DS1307Clock& ) = delete; // non copyable
+
+        /** Create a software clock for a DS1307.
+         * @param rtc Device to follow, must stay valid for the lifetime of the clock
+         */
+        DS1307Clock(DS1307<WIRE>& rtc) : rtc(rtc),
+                                         squareWave(false),
+                                         resyncInterval(DS1307_CLOCK_RESYNC_INTERVAL),
+                                         synced(false),
+                                         polling(false),
+                                         edges(0),
+                                         handledEdges(0),
+                                         phaseKnown(false)
+                                         {
+        }
+
+        bool begin(bool useSquareWave=false, uint16_t resyncInterval=DS1307_CLOCK_RESYNC_INTERVAL);
+
+        void handleSquareWave();
+        bool service();
+
+        bool isSynced();
+        uint32_t unixtime(uint16_t *milliseconds=0);
+        DateTime now();
+
+  private:
+        bool sync();
+        bool readRTC(uint32_t *t);
+
+        DS1307<WIRE>& rtc;
+        bool squareWave;
+        uint16_t resyncInterval;
+        bool synced;
+        uint32_t anchorTime;        // unix time of the second that started at anchorMillis
+        uint32_t anchorMillis;      // millis() at the start of that second
+        uint32_t lastResync;        // millis() of the last RTC read
+        bool polling;               // waiting for a rollover
+        uint8_t pollSeconds;
+        uint32_t lastPoll;
+        volatile uint32_t edgeMillis;
+        volatile uint8_t edges;
+        uint8_t handledEdges;
+        uint16_t phase;             // square wave edge minus second rollover, in ms
+        bool phaseKnown;
+};
+
+/** Start the clock.
+ * Reads the SECONDS register every DS1307_CLOCK_POLL_MS until it rolls over,
+ * which places the anchor on a second boundary to within half a poll
+ * interval, then takes the full time in one burst. This blocks for up to one
+ * second.
+ *
+ * With useSquareWave, SQW/OUT is switched to 1 Hz. Attach handleSquareWave()
+ * to the pin (open-drain, needs a pull-up) on either edge; the offset of the
+ * chosen edge from the seconds rollover is measured on the first edge.
+ *
+ * @param useSquareWave Re-anchor on every SQW/OUT edge
+ * @param resyncInterval Seconds between RTC reads that verify the time
+ * @return True on success, false on a bus error or if the oscillator is halted
+ */
+template <typename WIRE>
+bool DS1307Clock<WIRE>::begin(bool useSquareWave, uint16_t resyncInterval) {
+    squareWave = useSquareWave;
+    this->resyncInterval = resyncInterval;
+    phaseKnown = false;
+    if (squareWave) {
+        rtc.setSquareWaveRate(DS1307_SQW_RATE_1);
+        rtc.setSquareWaveEnabled(true);
+    }
+    return sync();
+}
+
+/** Record a square wave edge; call this from the SQW/OUT pin ISR.
+ * Only millis() is captured here, no bus traffic is generated.
+ */
+template <typename WIRE>
+void DS1307Clock<WIRE>::handleSquareWave() {
+    edgeMillis = millis();
+    edges++;
+}
+
+/** Keep the extrapolated time locked to the RTC.
+ * In square wave mode every edge moves the anchor to the edge's second
+ * boundary without any bus access, so the millis() oscillator error never
+ * builds up beyond one second's worth. Every resyncInterval seconds the RTC
+ * is read once, away from a second boundary, to catch missed or spurious
+ * edges.
+ *
+ * Without the square wave (or if the edges stop), every resyncInterval
+ * seconds the SECONDS register is read each DS1307_CLOCK_POLL_MS until it
+ * rolls over, and the clock is re-anchored on that rollover. Between checks
+ * there is no bus traffic at all.
+ *
+ * Call this from the main loop; it returns immediately when nothing is due.
+ * @return True if the bus was used
+ */
+template <typename WIRE>
+bool DS1307Clock<WIRE>::service() {
+    if (!synced) return false;
+    if (squareWave && edges != handledEdges) {
+        noInterrupts();
+        uint32_t stamp = edgeMillis;
+        handledEdges = edges;
+        interrupts();
+        if (!phaseKnown) {
+            phase = (stamp - anchorMillis) % 1000;
+            phaseKnown = true;
+        }
+        uint32_t boundary = stamp - phase;
+        anchorTime += (boundary - anchorMillis + 500) / 1000;
+        anchorMillis = boundary;
+    }
+
+    uint32_t t;
+    uint32_t m = millis();
+    if (m - lastResync < (uint32_t)resyncInterval * 1000) return false;
+    if (squareWave && m - anchorMillis < 2000) {
+        // the edges keep the phase, only the whole seconds need checking
+        uint16_t fraction = (m - anchorMillis) % 1000;
+        if (fraction < 100 || fraction > 900) return false;
+        if (!readRTC(&t)) return false;
+        lastResync = m;
+        anchorTime = t - (m - anchorMillis) / 1000;
+        return true;
+    }
+
+    if (m - lastPoll < DS1307_CLOCK_POLL_MS) return false;
+    uint32_t previous = lastPoll;
+    lastPoll = m;
+    uint8_t seconds = rtc.getSeconds();
+    if (!polling) {
+        polling = true;
+        pollSeconds = seconds;
+        return true;
+    }
+    if (seconds == pollSeconds) return true;
+    polling = false;
+    if (!readRTC(&t)) return true;
+    anchorTime = t;
+    anchorMillis = m - (m - previous) / 2;
+    lastResync = m;
+    return true;
+}
+
+/** Check whether the clock has been set from the RTC.
+ * @return True after a successful begin()
+ */
+template <typename WIRE>
+bool DS1307Clock<WIRE>::isSynced() {
+    return synced;
+}
+
+/** Get the current time without bus access.
+ * @param milliseconds Optional container for the millisecond within the second
+ * @return Seconds since 1970-01-01 00:00:00 in RTC local time
+ */
+template <typename WIRE>
+uint32_t DS1307Clock<WIRE>::unixtime(uint16_t *milliseconds) {
+    uint32_t elapsed = millis() - anchorMillis;
+    if (milliseconds) *milliseconds = elapsed % 1000;
+    return anchorTime + elapsed / 1000;
+}
+
+/** Get the current time without bus access.
+ * @return Current date and time
+ */
+template <typename WIRE>
+DateTime DS1307Clock<WIRE>::now() {
+    return DateTime(unixtime());
+}
+
+/** Anchor the clock on the next seconds rollover of the RTC. */
+template <typename WIRE>
+bool DS1307Clock<WIRE>::sync() {
+    uint8_t first = rtc.getSeconds();
+    uint32_t start = millis();
+    uint32_t previous = start;
+    uint32_t m;
+    for (;;) {
+        delay(DS1307_CLOCK_POLL_MS);
+        m = millis();
+        if (rtc.getSeconds() != first) break;
+        if (m - start > 1100) return false;
+        previous = m;
+    }
+    // the rollover happened somewhere between the last two reads
+    uint32_t rollover = m - (m - previous) / 2;
+    uint32_t t;
+    if (!readRTC(&t)) return false;
+    anchorTime = t;
+    anchorMillis = rollover;
+    lastResync = rollover;
+    lastPoll = rollover;
+    polling = false;
+    handledEdges = edges;
+    synced = true;
+    return true;
+}
+
+/** Read the RTC in one burst.
+ * @param t Container for the unix time
+ */
+template <typename WIRE>
+bool DS1307Clock<WIRE>::readRTC(uint32_t *t) {
+    uint16_t year;
+    uint8_t month, day, hours, minutes, seconds;
+    if (!rtc.getDateTime24(&year, &month, &day, &hours, &minutes, &seconds)) return false;
+    *t = DateTime(year, month, day, hours, minutes, seconds).unixtime();
+    return true;
+}
+
+#endif /* DS1307_INCLUDE_DATETIME_METHODS */
+
+#endif /* _DS1307_CLOCK_H_ */
@@ -285,6 +285,29 @@ int16_t HMC5843::getHeadingZ() {
     return (((int16_t)buffer[4]) << 8) | buffer[5];
 }
 
+/** Get 3-axis heading measurements and the status register in one burst.
+ * Reads the six data registers (X, Y, Z order in the device) and the STATUS
+ * register that follows them in a single 7-byte transaction. In continuous
+ * mode this replaces a separate status poll: a clear RDY bit in the returned
+ * status means the device started updating the data registers during the
+ * read, so the sample may mix two measurements and should be read again.
+ * Like getHeading(), this re-arms Single mode if it is active.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return STATUS register value read after the data
+ * @see HMC5843_RA_DATAX_H
+ * @see HMC5843_RA_STATUS
+ */
+uint8_t HMC5843::getHeadingWithStatus(int16_t *x, int16_t *y, int16_t *z) {
+    I2Cdev::readBytes(devAddr, HMC5843_RA_DATAX_H, 7, buffer);
+    if (mode == HMC5843_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5843_RA_MODE, HMC5843_MODE_SINGLE << (HMC5843_MODEREG_BIT - HMC5843_MODEREG_LENGTH + 1));
+    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
+    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    return buffer[6];
+}
+
 // STATUS register
 
 /** Get regulator enabled status.
@@ -166,6 +166,7 @@ class HMC5843 {
         int16_t getHeadingX();
         int16_t getHeadingY();
         int16_t getHeadingZ();
+        uint8_t getHeadingWithStatus(int16_t *x, int16_t *y, int16_t *z);
 
         // STATUS register
         bool getRegulatorEnabledStatus();
@@ -179,7 +180,7 @@ class HMC5843 {
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[6];
+        uint8_t buffer[7];
         uint8_t mode;
 };
 
@@ -0,0 +1,72 @@
+// I2Cdev library collection - HMC5843 continuous-mode streaming
+// Reads continuous-mode samples gated by the DRDY pin or the data rate and
+// queues them with timestamps
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "HMC5843_Stream.h"
+
+// output period in microseconds for HMC5843_RATE_0P5 ... HMC5843_RATE_50
+static const uint32_t HMC5843_RATE_PERIODS[] = { 2000000, 1000000, 500000, 200000, 100000, 50000, 20000 };
+
+/** Switch the device to continuous mode at the given data rate.
+ * DRDY goes low each time a new output is available, so attach the stream's
+ * handleInterrupt() to a FALLING edge when using the pin.
+ * @param device Device to start
+ * @param rate Data output rate (HMC5843_RATE_0P5 ... HMC5843_RATE_50)
+ * @return Output period in microseconds
+ * @see HMC5843_RATE_10
+ */
+uint32_t HMC5843Sample::start(HMC5843 *device, uint8_t rate) {
+    device->setDataRate(rate);
+    device->setMode(HMC5843_MODE_CONTINUOUS);
+    return HMC5843_RATE_PERIODS[rate < 7 ? rate : HMC5843_RATE_10];
+}
+
+/** Put the device in idle mode.
+ * @param device Device to stop
+ */
+void HMC5843Sample::stop(HMC5843 *device) {
+    device->setMode(HMC5843_MODE_IDLE);
+}
+
+/** Read X/Y/Z and the status register in one 7-byte burst.
+ * @param device Device to read from
+ * @param sample Sample to fill
+ * @return True if RDY was set, false if the device had started writing a new output
+ */
+bool HMC5843Sample::read(HMC5843 *device, HMC5843Sample *sample) {
+    uint8_t status = device->getHeadingWithStatus(&sample->x, &sample->y, &sample->z);
+    return (status & (1 << HMC5843_STATUS_READY_BIT)) != 0;
+}
+
+/** Create a streaming reader for an already initialized device.
+ * @param device Device to stream from
+ */
+HMC5843Stream::HMC5843Stream(HMC5843 *device) : I2CdevStream(device) {
+}
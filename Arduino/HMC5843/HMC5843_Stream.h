@@ -0,0 +1,58 @@
+// I2Cdev library collection - HMC5843 continuous-mode streaming
+// Reads continuous-mode samples gated by the DRDY pin or the data rate and
+// queues them with timestamps
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _HMC5843_STREAM_H_
+#define _HMC5843_STREAM_H_
+
+#include "HMC5843.h"
+#include "I2Cdev_Stream.h"
+
+// queue depth, must be a power of two
+#ifndef HMC5843_STREAM_QUEUE_SIZE
+#define HMC5843_STREAM_QUEUE_SIZE  8
+#endif
+
+/** One continuous-mode sample. */
+struct HMC5843Sample {
+    uint32_t timestamp;     // micros() of the DRDY edge, or of the read without DRDY
+    int16_t x, y, z;
+
+    static uint32_t start(HMC5843 *device, uint8_t rate);
+    static void stop(HMC5843 *device);
+    static bool read(HMC5843 *device, HMC5843Sample *sample);
+};
+
+class HMC5843Stream : public I2CdevStream<HMC5843, HMC5843Sample, HMC5843_STREAM_QUEUE_SIZE> {
+    public:
+        HMC5843Stream(HMC5843 *device);
+};
+
+#endif /* _HMC5843_STREAM_H_ */
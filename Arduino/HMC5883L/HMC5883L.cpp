@@ -308,6 +308,29 @@ int16_t HMC5883L::getHeadingZ() {
     return (((int16_t)buffer[2]) << 8) | buffer[3];
 }
 
+/** Get 3-axis heading measurements and the status register in one burst.
+ * Reads the six data registers (X, Z, Y order in the device) and the STATUS
+ * register that follows them in a single 7-byte transaction. In continuous
+ * mode this replaces a separate status poll: a clear RDY bit in the returned
+ * status means the device started updating the data registers during the
+ * read, so the sample may mix two measurements and should be read again.
+ * Like getHeading(), this re-arms Single mode if it is active.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return STATUS register value read after the data
+ * @see HMC5883L_RA_DATAX_H
+ * @see HMC5883L_RA_STATUS
+ */
+uint8_t HMC5883L::getHeadingWithStatus(int16_t *x, int16_t *y, int16_t *z) {
+    I2Cdev::readBytes(devAddr, HMC5883L_RA_DATAX_H, 7, buffer);
+    if (mode == HMC5883L_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5883L_RA_MODE, HMC5883L_MODE_SINGLE << (HMC5883L_MODEREG_BIT - HMC5883L_MODEREG_LENGTH + 1));
+    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *z = (((int16_t)buffer[2]) << 8) | buffer[3];
+    return buffer[6];
+}
+
 // STATUS register
 
 /** Get data output register lock status.
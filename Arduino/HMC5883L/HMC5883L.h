@@ -129,6 +129,7 @@ class HMC5883L {
         int16_t getHeadingX();
         int16_t getHeadingY();
         int16_t getHeadingZ();
+        uint8_t getHeadingWithStatus(int16_t *x, int16_t *y, int16_t *z);
 
         // STATUS register
         bool getLockStatus();
@@ -141,7 +142,7 @@ class HMC5883L {
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[6];
+        uint8_t buffer[7];
         uint8_t mode;
 };
 
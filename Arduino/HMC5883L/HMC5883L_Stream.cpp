@@ -0,0 +1,72 @@
+// I2Cdev library collection - HMC5883L continuous-mode streaming
+// Reads continuous-mode samples gated by the DRDY pin or the data rate and
+// queues them with timestamps
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "HMC5883L_Stream.h"
+
+// output period in microseconds for HMC5883L_RATE_0P75 ... HMC5883L_RATE_75
+static const uint32_t HMC5883L_RATE_PERIODS[] = { 1333333, 666667, 333333, 133333, 66667, 33333, 13333 };
+
+/** Switch the device to continuous mode at the given data rate.
+ * DRDY pulses low for 250us each time a new output is available, so attach
+ * the stream's handleInterrupt() to a FALLING edge when using the pin.
+ * @param device Device to start
+ * @param rate Data output rate (HMC5883L_RATE_0P75 ... HMC5883L_RATE_75)
+ * @return Output period in microseconds
+ * @see HMC5883L_RATE_15
+ */
+uint32_t HMC5883LSample::start(HMC5883L *device, uint8_t rate) {
+    device->setDataRate(rate);
+    device->setMode(HMC5883L_MODE_CONTINUOUS);
+    return HMC5883L_RATE_PERIODS[rate < 7 ? rate : HMC5883L_RATE_15];
+}
+
+/** Put the device in idle mode.
+ * @param device Device to stop
+ */
+void HMC5883LSample::stop(HMC5883L *device) {
+    device->setMode(HMC5883L_MODE_IDLE);
+}
+
+/** Read X/Y/Z and the status register in one 7-byte burst.
+ * @param device Device to read from
+ * @param sample Sample to fill
+ * @return True if RDY was set, false if the device had started writing a new output
+ */
+bool HMC5883LSample::read(HMC5883L *device, HMC5883LSample *sample) {
+    uint8_t status = device->getHeadingWithStatus(&sample->x, &sample->y, &sample->z);
+    return (status & (1 << HMC5883L_STATUS_READY_BIT)) != 0;
+}
+
+/** Create a streaming reader for an already initialized device.
+ * @param device Device to stream from
+ */
+HMC5883LStream::HMC5883LStream(HMC5883L *device) : I2CdevStream(device) {
+}
@@ -42,13 +42,22 @@ THE SOFTWARE.
 #define HTU21D_RESET               0xFE
 #define HTU21D_WRITE_USER_REGISTER 0xE6
 #define HTU21D_READ_USER_REGISTER  0xE7
+#define HTU21D_TRIGGER_TEMPERATURE_NOHOLD 0xF3
+#define HTU21D_TRIGGER_HUMIDITY_NOHOLD    0xF5
+
+// maximum conversion times at the default 14-bit/12-bit resolution
+#define HTU21D_TEMPERATURE_TIME_MS 50
+#define HTU21D_HUMIDITY_TIME_MS    16
+
+uint8_t htu21dCrc8(const uint8_t *data, uint8_t length);
 
 template <typename WIRE>
 class HTU21D {
     public:
 
         HTU21D(I2CdevT<WIRE, uint8_t>& i2cdev):_i2cdev(i2cdev),
-                                               devAddr(HTU21D_DEFAULT_ADDRESS) {
+                                               devAddr(HTU21D_DEFAULT_ADDRESS),
+                                               holdMaster(true) {
 
         }
 
@@ -78,42 +87,157 @@ class HTU21D {
         float getTemperature();
         float getHumidity();
 
+        /** Select hold master (default) or no hold master measurements.
+         * In hold master mode the sensor stretches the clock for the whole
+         * conversion (up to 50ms), blocking every other device on the bus. In
+         * no hold master mode getTemperature() and getHumidity() trigger the
+         * conversion, release the bus and poll for the result.
+         * @param enabled True for hold master, false for no hold master
+         */
+        void setHoldMaster(bool enabled) {
+            holdMaster = enabled;
+        }
+
+        // no hold master, non-blocking
+        bool startTemperature();
+        bool startHumidity();
+        int8_t getTemperatureResult(float *temperature);
+        int8_t getHumidityResult(float *humidity);
+
         void reset();
 
     private:
+        int8_t readResult(uint16_t *raw);
+        int8_t readMeasurement(uint8_t holdCommand, uint8_t noHoldCommand, uint16_t timeout, uint16_t *raw);
+
+        static float toTemperature(uint16_t raw) {
+            return ((float)raw)*175.72/65536.0-46.85;
+        }
+
+        static float toHumidity(uint16_t raw) {
+            return ((float)raw)*125.0/65536.0-6.0;
+        }
+
         I2CdevT<WIRE, uint8_t>& _i2cdev;
         uint8_t devAddr;
-        uint8_t buffer[2];
+        uint8_t buffer[3];
+        bool holdMaster;
 };
 
-/** Reads and returns the temperature, ignores the CRC field.
+/** Check and decode the 3-byte measurement in buffer.
+ * @param raw Measurement with the status bits (bit0 & bit1) cleared
+ * @return 1 if valid, -1 on a CRC mismatch
+ */
+template <typename WIRE>
+int8_t HTU21D<WIRE>::readResult(uint16_t *raw) {
+    if (htu21dCrc8(buffer, 2) != buffer[2]) return -1;
+    *raw = (((uint16_t)buffer[0] << 8) | buffer[1]) & 0xFFFC;
+    return 1;
+}
+
+/** Perform one complete measurement in the selected hold mode.
+ * @param holdCommand Hold master command
+ * @param noHoldCommand No hold master trigger command
+ * @param timeout Maximum conversion time in milliseconds
+ * @param raw Measurement with the status bits cleared
+ * @return 1 on success, -1 on a bus error, CRC mismatch or timeout
+ */
+template <typename WIRE>
+int8_t HTU21D<WIRE>::readMeasurement(uint8_t holdCommand, uint8_t noHoldCommand, uint16_t timeout, uint16_t *raw) {
+    if (holdMaster) {
+        if (3 != _i2cdev.readBytes(devAddr, holdCommand, 3, buffer)) return -1;
+        return readResult(raw);
+    }
+    if (!_i2cdev.writeBytes(devAddr, noHoldCommand, 0, buffer)) return -1;
+    uint32_t start = millis();
+    // each poll is just an address byte the sensor NACKs until it is done
+    do {
+        delay(1);
+        uint8_t count = _i2cdev.readRaw(devAddr, 3, buffer);
+        if (count == 3) return readResult(raw);
+        if (count != 0) return -1;
+    } while (millis() - start <= timeout);
+    return -1;
+}
+
+/** Reads and returns the temperature, validating the CRC field.
  * @return The measured temperature, or NaN if the operation failed.
+ * @see setHoldMaster()
  */
 template <typename WIRE>
 float HTU21D<WIRE>::getTemperature() {
-    // Ignore the CRC byte
     uint16_t t = 0;
-    if (1!=_i2cdev.readWord(devAddr, HTU21D_RA_TEMPERATURE, &t)){
+    if (1 != readMeasurement(HTU21D_RA_TEMPERATURE, HTU21D_TRIGGER_TEMPERATURE_NOHOLD, HTU21D_TEMPERATURE_TIME_MS, &t)){
         return NAN;
     }
-    // clear the status bits (bit0 & bit1) and calculate the temperature
-    // as per the formula in the datasheet
-    return ((float)(t&0xFFFC))*175.72/65536.0-46.85;
+    // calculate the temperature as per the formula in the datasheet
+    return toTemperature(t);
 }
 
-/** Reads and returns the humidity, ignores the CRC field
+/** Reads and returns the humidity, validating the CRC field.
  * @return The measured humidity, or NaN if the operation failed.
+ * @see setHoldMaster()
  */
 template <typename WIRE>
 float HTU21D<WIRE>::getHumidity() {
-    // Ignore the CRC byte
     uint16_t t = 0;
-    if (1!=_i2cdev.readWord(devAddr, HTU21D_RA_HUMIDITY, &t)){
+    if (1 != readMeasurement(HTU21D_RA_HUMIDITY, HTU21D_TRIGGER_HUMIDITY_NOHOLD, HTU21D_HUMIDITY_TIME_MS, &t)){
         return NAN;
     }
-    // clear the status bits (bit0 & bit1) and calculate the humidity
-    // as per the formula in the datasheet
-    return ((float)(t&0xFFFC))*125.0/65536.0-6.0;
+    // calculate the humidity as per the formula in the datasheet
+    return toHumidity(t);
+}
+
+/** Trigger a no hold master temperature measurement and return immediately.
+ * The bus stays free during the conversion; collect the result with
+ * getTemperatureResult(), at the earliest after HTU21D_TEMPERATURE_TIME_MS
+ * to avoid needless polls.
+ * @return True if the sensor accepted the command
+ */
+template <typename WIRE>
+bool HTU21D<WIRE>::startTemperature() {
+    return _i2cdev.writeBytes(devAddr, HTU21D_TRIGGER_TEMPERATURE_NOHOLD, 0, buffer);
+}
+
+/** Trigger a no hold master humidity measurement and return immediately.
+ * @return True if the sensor accepted the command
+ * @see startTemperature()
+ */
+template <typename WIRE>
+bool HTU21D<WIRE>::startHumidity() {
+    return _i2cdev.writeBytes(devAddr, HTU21D_TRIGGER_HUMIDITY_NOHOLD, 0, buffer);
+}
+
+/** Poll for the result of startTemperature().
+ * Costs a single address byte while the sensor is still converting.
+ * @param temperature Destination for the temperature in degrees Celsius
+ * @return 1 if the result was stored, 0 if the conversion is still running,
+ *         -1 on a bus error or CRC mismatch
+ */
+template <typename WIRE>
+int8_t HTU21D<WIRE>::getTemperatureResult(float *temperature) {
+    uint16_t t = 0;
+    uint8_t count = _i2cdev.readRaw(devAddr, 3, buffer);
+    if (count == 0) return 0;
+    if (count != 3 || 1 != readResult(&t)) return -1;
+    *temperature = toTemperature(t);
+    return 1;
+}
+
+/** Poll for the result of startHumidity().
+ * @param humidity Destination for the relative humidity in percent
+ * @return 1 if the result was stored, 0 if the conversion is still running,
+ *         -1 on a bus error or CRC mismatch
+ * @see getTemperatureResult()
+ */
+template <typename WIRE>
+int8_t HTU21D<WIRE>::getHumidityResult(float *humidity) {
+    uint16_t t = 0;
+    uint8_t count = _i2cdev.readRaw(devAddr, 3, buffer);
+    if (count == 0) return 0;
+    if (count != 3 || 1 != readResult(&t)) return -1;
+    *humidity = toHumidity(t);
+    return 1;
 }
 
 /** Does a soft reset of the HTU21D
@@ -62,9 +62,12 @@ THE SOFTWARE.
 #else
 #include "Arduino.h"
 #endif
-#endif
-
 #include <Wire.h>
+#else
+// no Arduino core: the port supplies its own bus type and the I2CdevT
+// specializations for it (e.g. MSP430/I2Cdev/I2Cdev_MSP430.h)
+#include <stdint.h>
+#endif
 
 // 1000ms default read _timeout (modify with "I2Cdev::_timeout = [ms];")
 #ifndef I2CDEV_DEFAULT_READ_TIMEOUT
@@ -91,6 +94,7 @@ public:
   int8_t readWord(uint8_t devAddr, RegAddr regAddr, uint16_t *data);
   int8_t readBytes(uint8_t devAddr, RegAddr regAddr, uint8_t length, uint8_t *data);
   int8_t readWords(uint8_t devAddr, RegAddr regAddr, uint8_t length, uint16_t *data);
+  uint8_t readRaw(uint8_t devAddr, uint8_t length, uint8_t *data);
 
   bool writeBit(uint8_t devAddr, RegAddr regAddr, uint8_t bitNum, uint8_t data);
   bool writeBitW(uint8_t devAddr, RegAddr regAddr, uint8_t bitNum, uint16_t data);
@@ -179,6 +183,28 @@ int8_t I2CdevT<WIRE, RegAddr>::readWord(uint8_t devAddr, RegAddr regAddr, uint16
   return readWords(devAddr, regAddr, 1, data);
 }
 
+/** Read bytes without sending a register address first.
+ * For command-based devices that return a result to a plain read request,
+ * e.g. after a "no hold master" measurement. A device that is still busy
+ * NACKs its address, which is reported as 0 bytes read rather than a
+ * failure, so this can be used to poll for completion. Reads are limited
+ * to the Wire buffer size. The count is unsigned, so buffers of 128 bytes
+ * and more are reported correctly.
+ * @param devAddr I2C slave device address
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @return Number of bytes read (0 if the device did not acknowledge)
+ */
+template<typename WIRE, typename RegAddr>
+uint8_t I2CdevT<WIRE, RegAddr>::readRaw(uint8_t devAddr, uint8_t length, uint8_t *data) {
+  uint8_t count = 0;
+  uint8_t received = _wire.requestFrom(devAddr, length);
+  for (; count < received && _wire.available(); count++) {
+    data[count] = _wire.read();
+  }
+  return count;
+}
+
 /** Read a single bit from a 16-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
@@ -334,9 +360,10 @@ bool I2CdevT<WIRE, RegAddr>::writeBitsW(uint8_t devAddr, RegAddr regAddr, uint8_
   }
 }
 
-
+#ifdef ARDUINO
 typedef I2CdevT<TwoWire, uint16_t> I2Cdev16;
 typedef I2CdevT<TwoWire, uint8_t> I2Cdev8;
 typedef I2CdevT<TwoWire, uint8_t> I2Cdev;
+#endif
 
 #endif /* _I2CDEV_H_ */
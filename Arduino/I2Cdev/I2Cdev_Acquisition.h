@@ -0,0 +1,160 @@
+// I2Cdev library collection - interrupt-stamped deferred acquisition
+// Shared by device drivers whose INT pin signals data-ready: the ISR only
+// stamps the interrupt, the register burst is done later from service()
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEV_ACQUISITION_H_
+#define _I2CDEV_ACQUISITION_H_
+
+// include the device header first; it brings in the core for micros()
+#include "I2Cdev_RingBuffer.h"
+
+/** Data-ready acquisition for a device that keeps only its newest sample.
+ * Device is the driver class, Sample the queued sample type. Sample must have
+ * a uint32_t timestamp member and provide
+ *
+ *     static bool read(Device *device, Sample *sample);
+ *
+ * which burst-reads INT_STATUS together with the data registers and returns
+ * whether the data-ready bit was set, i.e. whether the data had not been read
+ * before. QUEUE_SIZE and PENDING_SIZE must be powers of two.
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE, uint8_t PENDING_SIZE>
+class I2CdevAcquisition {
+    public:
+        I2CdevAcquisition(Device *device);
+
+        void handleInterrupt();
+        uint8_t service();
+
+        uint8_t available();
+        bool getSample(Sample *sample);
+        uint16_t getDroppedCount();
+
+    protected:
+        void reset();
+
+        Device *device;
+        I2CdevRingBuffer<uint32_t, PENDING_SIZE> pending;
+        I2CdevRingBuffer<Sample, QUEUE_SIZE> samples;
+        volatile uint8_t isrDropped;
+        uint16_t serviceDropped;
+};
+
+/** Create an acquisition driver for an already initialized device.
+ * @param device Device whose INT pin is attached to an interrupt that calls
+ *        handleInterrupt()
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE, uint8_t PENDING_SIZE>
+I2CdevAcquisition<Device, Sample, QUEUE_SIZE, PENDING_SIZE>::I2CdevAcquisition(Device *device) {
+    this->device = device;
+    isrDropped = 0;
+    serviceDropped = 0;
+}
+
+/** Discard pending interrupts and queued samples. */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE, uint8_t PENDING_SIZE>
+void I2CdevAcquisition<Device, Sample, QUEUE_SIZE, PENDING_SIZE>::reset() {
+    pending.drop();
+    samples.drop();
+}
+
+/** Record a data-ready interrupt; call this from the INT pin ISR.
+ * Only the micros() timestamp is captured here, no bus traffic is generated.
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE, uint8_t PENDING_SIZE>
+void I2CdevAcquisition<Device, Sample, QUEUE_SIZE, PENDING_SIZE>::handleInterrupt() {
+    if (!pending.push(micros())) isrDropped++;
+}
+
+/** Perform the deferred read for the interrupts recorded since the last call.
+ * The data registers only ever hold the newest sample, so if several
+ * interrupts are pending only the newest one is read and the older ones are
+ * counted as dropped.
+ *
+ * An interrupt can also arrive while the burst is in progress. The registers
+ * were then updated before they were read, so the data belongs to that newer
+ * stamp, and the stamp it replaces is counted as dropped. A read whose
+ * data-ready bit is clear returns registers that were already read, and is
+ * discarded instead of queued twice. The one remaining ambiguity is an
+ * interrupt in the few microseconds between the end of the burst and the
+ * pending check; its stamp is then given to the sample just read.
+ *
+ * Call this from the main loop (or a task) at least once per sample period;
+ * it returns immediately when nothing is pending.
+ * @return Number of samples added to the queue (0 or 1)
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE, uint8_t PENDING_SIZE>
+uint8_t I2CdevAcquisition<Device, Sample, QUEUE_SIZE, PENDING_SIZE>::service() {
+    uint32_t timestamp;
+    if (!pending.pop(&timestamp)) return 0;
+    while (pending.pop(&timestamp)) serviceDropped++;
+
+    if (samples.isFull()) {
+        serviceDropped++;
+        return 0;
+    }
+    Sample s;
+    bool fresh = Sample::read(device, &s);
+    while (pending.pop(&timestamp)) serviceDropped++;
+    if (!fresh) return 0;
+    s.timestamp = timestamp;
+    samples.push(s);
+    return 1;
+}
+
+/** Get the number of samples waiting in the queue.
+ * @return Queued sample count
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE, uint8_t PENDING_SIZE>
+uint8_t I2CdevAcquisition<Device, Sample, QUEUE_SIZE, PENDING_SIZE>::available() {
+    return samples.available();
+}
+
+/** Take the oldest sample out of the queue.
+ * May be called from a different context than service().
+ * @param sample Container for the sample
+ * @return True if a sample was returned, false if the queue is empty
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE, uint8_t PENDING_SIZE>
+bool I2CdevAcquisition<Device, Sample, QUEUE_SIZE, PENDING_SIZE>::getSample(Sample *sample) {
+    return samples.pop(sample);
+}
+
+/** Get the number of samples lost so far.
+ * Counts interrupts that overflowed the pending queue, samples superseded
+ * before they were read and samples discarded because the queue was full.
+ * @return Dropped sample count
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE, uint8_t PENDING_SIZE>
+uint16_t I2CdevAcquisition<Device, Sample, QUEUE_SIZE, PENDING_SIZE>::getDroppedCount() {
+    return serviceDropped + isrDropped;
+}
+
+#endif /* _I2CDEV_ACQUISITION_H_ */
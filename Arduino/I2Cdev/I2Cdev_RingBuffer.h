@@ -0,0 +1,120 @@
+// I2Cdev library collection - lock-free single-producer/single-consumer ring buffer
+// Used by device classes to hand time-stamped samples from an ISR or a service
+// routine to the application without disabling interrupts
+//
+// Changelog:
+//      ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEV_RINGBUFFER_H_
+#define _I2CDEV_RINGBUFFER_H_
+
+#include <stdint.h>
+
+// keep the compiler from moving element accesses across index updates
+#define I2CDEV_RING_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+/** Fixed-size single-producer/single-consumer queue.
+ * Exactly one context may call push() and exactly one (possibly different)
+ * context may call pop()/peek()/drop(). The head and tail indices are single
+ * bytes, so they are updated atomically even on 8-bit MCUs and neither side
+ * ever has to disable interrupts.
+ *
+ * SIZE must be a power of two no larger than 128.
+ */
+template<typename T, uint8_t SIZE>
+class I2CdevRingBuffer {
+  static_assert(SIZE > 0 && SIZE <= 128 && (SIZE & (SIZE - 1)) == 0, "SIZE must be a power of two <= 128");
+
+public:
+  I2CdevRingBuffer() : _head(0), _tail(0) {
+  }
+
+  /** Append an element (producer side).
+   * @return True if queued, false if the buffer is full
+   */
+  bool push(const T& item) {
+    uint8_t head = _head;
+    if ((uint8_t)(head - _tail) >= SIZE) return false;
+    _items[head & (SIZE - 1)] = item;
+    I2CDEV_RING_BARRIER();
+    _head = head + 1;
+    return true;
+  }
+
+  /** Remove the oldest element (consumer side).
+   * @return True if an element was copied to item, false if the buffer is empty
+   */
+  bool pop(T *item) {
+    uint8_t tail = _tail;
+    if (tail == _head) return false;
+    I2CDEV_RING_BARRIER();
+    *item = _items[tail & (SIZE - 1)];
+    I2CDEV_RING_BARRIER();
+    _tail = tail + 1;
+    return true;
+  }
+
+  /** Copy the oldest element without removing it (consumer side).
+   * @return True if an element was copied to item, false if the buffer is empty
+   */
+  bool peek(T *item) {
+    uint8_t tail = _tail;
+    if (tail == _head) return false;
+    I2CDEV_RING_BARRIER();
+    *item = _items[tail & (SIZE - 1)];
+    return true;
+  }
+
+  /** Discard every queued element (consumer side). */
+  void drop() {
+    _tail = _head;
+  }
+
+  /** Number of queued elements (exact from either side, a snapshot otherwise). */
+  uint8_t available() {
+    return (uint8_t)(_head - _tail);
+  }
+
+  bool isEmpty() {
+    return _head == _tail;
+  }
+
+  bool isFull() {
+    return (uint8_t)(_head - _tail) >= SIZE;
+  }
+
+  uint8_t capacity() {
+    return SIZE;
+  }
+
+private:
+  T _items[SIZE];
+  volatile uint8_t _head; // free-running, written by the producer only
+  volatile uint8_t _tail; // free-running, written by the consumer only
+};
+
+#endif /* _I2CDEV_RINGBUFFER_H_ */
@@ -0,0 +1,219 @@
+// I2Cdev library collection - timestamped continuous-mode streaming
+// Shared by device drivers that measure on their own at a fixed output rate:
+// reads are paced by a data-ready pin or by the output period
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEV_STREAM_H_
+#define _I2CDEV_STREAM_H_
+
+// include the device header first; it brings in the core for micros()
+#include "I2Cdev_RingBuffer.h"
+
+/** Continuous-mode streaming for a device with a data-ready pin and status bit.
+ * Device is the driver class, Sample the queued sample type. Sample must have
+ * a uint32_t timestamp member and provide
+ *
+ *     static uint32_t start(Device *device, uint8_t rate);
+ *     static void stop(Device *device);
+ *     static bool read(Device *device, Sample *sample);
+ *
+ * start() switches the device to continuous mode at the given rate and
+ * returns the output period in microseconds (from the device's rate table),
+ * stop() idles it, and read() fetches one sample together with the status
+ * register and returns the data-ready bit. The device must keep the output
+ * registers locked while a burst is in progress, so every completed burst
+ * holds one consistent output. QUEUE_SIZE must be a power of two.
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE>
+class I2CdevStream {
+    public:
+        I2CdevStream(Device *device);
+
+        void begin(uint8_t rate, bool useReadyPin=false);
+        void end();
+
+        void handleInterrupt();
+        uint8_t service();
+
+        uint8_t available();
+        bool getSample(Sample *sample);
+        uint16_t getOverrunCount();
+
+    protected:
+        Device *device;
+        I2CdevRingBuffer<Sample, QUEUE_SIZE> samples;
+        volatile uint32_t readyTimestamp;
+        volatile uint8_t readyCount;
+        uint8_t readyHandled;
+        bool useReadyPin;
+        bool running;
+        uint32_t period;
+        uint32_t lastRead;
+        uint16_t overruns;
+};
+
+/** Create a streaming reader for an already initialized device.
+ * @param device Device to stream from
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE>
+I2CdevStream<Device, Sample, QUEUE_SIZE>::I2CdevStream(Device *device) {
+    this->device = device;
+    readyCount = 0;
+    readyHandled = 0;
+    useReadyPin = false;
+    running = false;
+    overruns = 0;
+}
+
+/** Switch the device to continuous mode and start streaming.
+ * In continuous mode the device measures on its own at the selected data
+ * rate, so no mode register write is needed per sample, and every sample is
+ * fetched with one data+status burst.
+ *
+ * With useReadyPin, one read is made per data-ready edge recorded by
+ * handleInterrupt(), so every output is read exactly once unless service()
+ * falls behind. Without it, reads are paced by the output period and kept in
+ * phase with the device through the status ready bit (see service()); the
+ * MCU and sensor clocks drift, so use the pin when every sample must be
+ * captured exactly once.
+ * @param rate Data output rate, as passed to the device's setDataRate()
+ * @param useReadyPin Trigger reads from handleInterrupt() instead of the timer
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE>
+void I2CdevStream<Device, Sample, QUEUE_SIZE>::begin(uint8_t rate, bool useReadyPin) {
+    this->useReadyPin = useReadyPin;
+    samples.drop();
+    overruns = 0;
+    readyHandled = readyCount;
+    period = Sample::start(device, rate);
+    lastRead = micros();
+    running = true;
+}
+
+/** Stop streaming and put the device in idle mode.
+ * Samples already queued remain available.
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE>
+void I2CdevStream<Device, Sample, QUEUE_SIZE>::end() {
+    running = false;
+    Sample::stop(device);
+}
+
+/** Record a data-ready edge; call this from the data-ready pin ISR.
+ * Only the micros() timestamp is captured here, no bus traffic is generated.
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE>
+void I2CdevStream<Device, Sample, QUEUE_SIZE>::handleInterrupt() {
+    readyTimestamp = micros();
+    readyCount++;
+}
+
+/** Read a new sample if one is due.
+ * Never blocks, and every completed burst is queued: the output registers
+ * are locked for the duration of the burst, so the data is consistent even
+ * if the device starts an update meanwhile.
+ *
+ * With the ready pin, a read is made once per recorded edge; edges that
+ * arrived since the previous call beyond the newest one are counted as
+ * overruns, since the output registers only hold the newest sample. An edge
+ * during the burst is left for the next call, which then reads the output it
+ * announced.
+ *
+ * Without the pin, a read is made once per output period; a call later than
+ * one full period past the due time is counted as overrun for each period
+ * missed. The two clocks drift, so the reads slowly slide against the
+ * device's own update instants, and a read can only repeat or skip an output
+ * when it reaches one of them. That is exactly when the ready bit returned by
+ * the burst is clear (it drops when the device starts writing an output and
+ * sets again once the write completes). Such a read may return the output
+ * already read before, so seeing the bit clear brings the next read forward
+ * by half a period, midway between two outputs, and the drift has to build
+ * up by half a period before it can happen again.
+ * @return Number of samples added to the queue (0 or 1)
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE>
+uint8_t I2CdevStream<Device, Sample, QUEUE_SIZE>::service() {
+    if (!running) return 0;
+    Sample s;
+    uint32_t now = micros();
+
+    if (useReadyPin) {
+        uint8_t count = readyCount;
+        if (count == readyHandled) return 0;
+        s.timestamp = readyTimestamp;
+        // retry on the next call if another edge arrived while copying the timestamp
+        if (readyCount != count) return 0;
+        overruns += (uint8_t)(count - readyHandled - 1);
+        readyHandled = count;
+        Sample::read(device, &s);
+    } else {
+        uint32_t elapsed = now - lastRead;
+        if (elapsed < period) return 0;
+        if (elapsed >= 2 * period) overruns += elapsed / period - 1;
+        s.timestamp = now;
+        // keep the schedule rather than the call time, so call latency doesn't add up
+        lastRead += elapsed - elapsed % period;
+        if (!Sample::read(device, &s)) lastRead = now - period / 2;
+    }
+
+    if (!samples.push(s)) {
+        overruns++;
+        return 0;
+    }
+    return 1;
+}
+
+/** Get the number of samples waiting in the queue.
+ * @return Queued sample count
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE>
+uint8_t I2CdevStream<Device, Sample, QUEUE_SIZE>::available() {
+    return samples.available();
+}
+
+/** Remove the oldest sample from the queue.
+ * @param sample Sample to fill
+ * @return True if a sample was returned, false if the queue is empty
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE>
+bool I2CdevStream<Device, Sample, QUEUE_SIZE>::getSample(Sample *sample) {
+    return samples.pop(sample);
+}
+
+/** Get the number of samples lost since begin().
+ * Counts samples overwritten in the device before they were read as well as
+ * samples dropped because the queue was full.
+ * @return Overrun count
+ */
+template <typename Device, typename Sample, uint8_t QUEUE_SIZE>
+uint16_t I2CdevStream<Device, Sample, QUEUE_SIZE>::getOverrunCount() {
+    return overruns;
+}
+
+#endif /* _I2CDEV_STREAM_H_ */
@@ -368,6 +368,41 @@ void ITG3200::getRotation(int16_t* x, int16_t* y, int16_t* z) {
     *y = (((int16_t)buffer[2]) << 8) | buffer[3];
     *z = (((int16_t)buffer[4]) << 8) | buffer[5];
 }
+/** Get temperature and 3-axis gyroscope readings in one burst.
+ * TEMP_OUT_H through GYRO_ZOUT_L are contiguous, so a single 8-byte read
+ * returns the temperature and rotation of the same sample.
+ * @param x 16-bit signed integer container for X-axis rotation
+ * @param y 16-bit signed integer container for Y-axis rotation
+ * @param z 16-bit signed integer container for Z-axis rotation
+ * @param t 16-bit signed integer container for temperature
+ * @see ITG3200_RA_TEMP_OUT_H
+ */
+void ITG3200::getMotion(int16_t* x, int16_t* y, int16_t* z, int16_t* t) {
+    I2Cdev::readBytes(devAddr, ITG3200_RA_TEMP_OUT_H, 8, buffer);
+    *t = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *x = (((int16_t)buffer[2]) << 8) | buffer[3];
+    *y = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *z = (((int16_t)buffer[6]) << 8) | buffer[7];
+}
+/** Get interrupt status, temperature and 3-axis gyroscope readings in one burst.
+ * INT_STATUS directly precedes TEMP_OUT_H, so a single 9-byte read returns
+ * (and, with ITG3200_INTCLEAR_STATUSREAD, clears) the interrupt status together
+ * with the sample it refers to.
+ * @param x 16-bit signed integer container for X-axis rotation
+ * @param y 16-bit signed integer container for Y-axis rotation
+ * @param z 16-bit signed integer container for Z-axis rotation
+ * @param t 16-bit signed integer container for temperature
+ * @return INT_STATUS register value
+ * @see ITG3200_RA_INT_STATUS
+ */
+uint8_t ITG3200::getIntStatusAndMotion(int16_t* x, int16_t* y, int16_t* z, int16_t* t) {
+    I2Cdev::readBytes(devAddr, ITG3200_RA_INT_STATUS, 9, buffer);
+    *t = (((int16_t)buffer[1]) << 8) | buffer[2];
+    *x = (((int16_t)buffer[3]) << 8) | buffer[4];
+    *y = (((int16_t)buffer[5]) << 8) | buffer[6];
+    *z = (((int16_t)buffer[7]) << 8) | buffer[8];
+    return buffer[0];
+}
 /** Get X-axis gyroscope reading.
  * @return X-axis rotation measurement in 16-bit 2's complement format
  * @see ITG3200_RA_GYRO_XOUT_H
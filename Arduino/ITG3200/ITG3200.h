@@ -154,6 +154,8 @@ class ITG3200 {
         
         // GYRO_*OUT_* registers
         void getRotation(int16_t* x, int16_t* y, int16_t* z);
+        void getMotion(int16_t* x, int16_t* y, int16_t* z, int16_t* t);
+        uint8_t getIntStatusAndMotion(int16_t* x, int16_t* y, int16_t* z, int16_t* t);
         int16_t getRotationX();
         int16_t getRotationY();
         int16_t getRotationZ();
@@ -173,7 +175,7 @@ class ITG3200 {
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[6];
+        uint8_t buffer[9];
 };
 
 #endif /* _ITG3200_H_ */
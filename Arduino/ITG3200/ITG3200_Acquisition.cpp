@@ -0,0 +1,67 @@
+// I2Cdev library collection - ITG3200 data-ready acquisition
+// Queues gyroscope samples stamped in the INT pin ISR, read with one burst per
+// data-ready interrupt
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "ITG3200_Acquisition.h"
+
+/** Read INT_STATUS and the data registers in one 9-byte burst.
+ * @param device Device to read
+ * @param sample Container for the status and data
+ * @return True if RAW_DATA_READY was set, false if the data was already read
+ */
+bool ITG3200Sample::read(ITG3200 *device, ITG3200Sample *sample) {
+    sample->intStatus = device->getIntStatusAndMotion(&sample->gx, &sample->gy, &sample->gz, &sample->temperature);
+    return (sample->intStatus & (1 << ITG3200_INTSTAT_RAW_DATA_READY_BIT)) != 0;
+}
+
+/** Create an acquisition driver for an already initialized device.
+ * @param device Device whose INT pin is attached to an interrupt that calls
+ *        handleInterrupt()
+ */
+ITG3200Acquisition::ITG3200Acquisition(ITG3200 *device) : I2CdevAcquisition(device) {
+}
+
+/** Configure the INT pin for data-ready acquisition.
+ * The pin is set up as an active-high, push-pull 50us pulse that is cleared by
+ * reading INT_STATUS, and the data-ready interrupt is the only one enabled. The
+ * sample rate itself is left as configured: 8kHz (DLPF_BW_256) or 1kHz (all
+ * other bandwidths) divided by SMPLRT_DIV + 1, see ITG3200::setRate(). Attach
+ * the ISR on a RISING edge after calling this.
+ */
+void ITG3200Acquisition::initialize() {
+    device->setInterruptMode(ITG3200_INTMODE_ACTIVEHIGH);
+    device->setInterruptDrive(ITG3200_INTDRV_PUSHPULL);
+    device->setInterruptLatch(ITG3200_INTLATCH_50USPULSE);
+    device->setInterruptLatchClear(ITG3200_INTCLEAR_STATUSREAD);
+    device->setIntDeviceReadyEnabled(false);
+    device->setIntDataReadyEnabled(true);
+    device->getIntDataReadyStatus();
+    reset();
+}
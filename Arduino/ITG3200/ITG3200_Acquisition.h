@@ -0,0 +1,63 @@
+// I2Cdev library collection - ITG3200 data-ready acquisition
+// Queues gyroscope samples stamped in the INT pin ISR, read with one burst per
+// data-ready interrupt
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _ITG3200_ACQUISITION_H_
+#define _ITG3200_ACQUISITION_H_
+
+#include "ITG3200.h"
+#include "I2Cdev_Acquisition.h"
+
+// queue depths, must be powers of two
+#ifndef ITG3200_ACQUISITION_QUEUE_SIZE
+#define ITG3200_ACQUISITION_QUEUE_SIZE      8
+#endif
+#ifndef ITG3200_ACQUISITION_PENDING_SIZE
+#define ITG3200_ACQUISITION_PENDING_SIZE    4
+#endif
+
+/** One data-ready sample with the time its interrupt was raised. */
+struct ITG3200Sample {
+    uint32_t timestamp;     // micros() captured in the INT pin ISR
+    uint8_t intStatus;      // INT_STATUS read together with the data
+    int16_t temperature;
+    int16_t gx, gy, gz;
+
+    static bool read(ITG3200 *device, ITG3200Sample *sample);
+};
+
+class ITG3200Acquisition : public I2CdevAcquisition<ITG3200, ITG3200Sample, ITG3200_ACQUISITION_QUEUE_SIZE, ITG3200_ACQUISITION_PENDING_SIZE> {
+    public:
+        ITG3200Acquisition(ITG3200 *device);
+
+        void initialize();
+};
+
+#endif /* _ITG3200_ACQUISITION_H_ */
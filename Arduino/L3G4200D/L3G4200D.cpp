@@ -37,6 +37,7 @@ THE SOFTWARE.
  */
 L3G4200D::L3G4200D() {
     devAddr = L3G4200D_DEFAULT_ADDRESS;
+    endianMode = 0;
 }
 
 /** Specific address constructor.
@@ -46,6 +47,7 @@ L3G4200D::L3G4200D() {
  */
 L3G4200D::L3G4200D(uint8_t address) {
     devAddr = address;
+    endianMode = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -579,6 +581,7 @@ bool L3G4200D::getBlockDataUpdateEnabled() {
 void L3G4200D::setEndianMode(bool endianness) {
 	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT, 
 		endianness);
+	endianMode = getEndianMode();
 }
 
 /** Get the data endian mode
@@ -1102,6 +1105,56 @@ uint8_t L3G4200D::getFIFOStoredDataLevel() {
     return buffer[0];
 }
 
+/** Drain the FIFO with burst reads
+ * FIFO_SRC is read once to get the number of stored frames, then the frames
+ * are read with auto-increment (register address MSB set) bursts starting at
+ * OUT_X_L. In FIFO modes the address wraps from OUT_Z_H back to OUT_X_L and
+ * advances to the next FIFO slot, so consecutive frames come out of a single
+ * burst. Each burst is limited to L3G4200D_FIFO_BURST_FRAMES whole frames
+ * so that a frame is never split across two Wire transfers.
+ *
+ * Frames are decoded in place into data as X, Y, Z triplets, oldest first.
+ * @param data Array of at least 3 * maxFrames 16-bit integers
+ * @param maxFrames Capacity of data in frames; remaining frames stay queued
+ * @param overrun Optional container for the FIFO overrun flag
+ * @return Number of frames read
+ * @see L3G4200D_RA_FIFO_SRC
+ * @see L3G4200D_FIFO_BURST_FRAMES
+ */
+uint8_t L3G4200D::getFIFOAngularVelocity(int16_t* data, uint8_t maxFrames, bool* overrun) {
+	uint8_t count;
+	I2Cdev::readByte(devAddr, L3G4200D_RA_FIFO_SRC, buffer);
+	if (overrun) *overrun = buffer[0] & (1 << L3G4200D_FIFO_OVRN_BIT);
+	if (buffer[0] & (1 << L3G4200D_FIFO_EMPTY_BIT)) {
+		count = 0;
+	} else if (buffer[0] & (1 << L3G4200D_FIFO_OVRN_BIT)) {
+		count = L3G4200D_FIFO_DEPTH; // FSS saturates below the full level
+	} else {
+		count = buffer[0] & ((1 << L3G4200D_FIFO_FSS_LENGTH) - 1);
+	}
+	if (count > maxFrames) count = maxFrames;
+
+	uint8_t *raw = (uint8_t *)data;
+	for (uint8_t done = 0; done < count; ) {
+		uint8_t frames = count - done;
+		if (frames > L3G4200D_FIFO_BURST_FRAMES) frames = L3G4200D_FIFO_BURST_FRAMES;
+		I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L | 0x80, frames * 6, raw + done * 6);
+		done += frames;
+	}
+
+	// every value occupies the same two bytes it was read into
+	for (uint8_t i = 0; i < count * 3; i++) {
+		uint8_t first = raw[i * 2];
+		uint8_t second = raw[i * 2 + 1];
+		if (endianMode == L3G4200D_BIG_ENDIAN) {
+			data[i] = (((int16_t)first) << 8) | second;
+		} else {
+			data[i] = (((int16_t)second) << 8) | first;
+		}
+	}
+	return count;
+}
+
 // INT1_CFG register, r/w
 
 /** Set the combination mode for interrupt events
@@ -178,6 +178,17 @@ THE SOFTWARE.
 #define L3G4200D_FIFO_FSS_BIT      4
 #define L3G4200D_FIFO_FSS_LENGTH   5
 
+#define L3G4200D_FIFO_DEPTH       32
+
+// whole frames per burst read, limited by the Wire library receive buffer
+#ifndef L3G4200D_FIFO_BURST_FRAMES
+#ifdef BUFFER_LENGTH
+#define L3G4200D_FIFO_BURST_FRAMES (BUFFER_LENGTH / 6)
+#else
+#define L3G4200D_FIFO_BURST_FRAMES 5
+#endif
+#endif
+
 #define L3G4200D_INT1_AND_OR_BIT   7
 #define L3G4200D_INT1_LIR_BIT      6
 #define L3G4200D_ZHIE_BIT          5
@@ -307,6 +318,7 @@ class L3G4200D {
 		bool getFIFOOverrun();
 		bool getFIFOEmpty();
 		uint8_t getFIFOStoredDataLevel();
+		uint8_t getFIFOAngularVelocity(int16_t* data, uint8_t maxFrames, bool* overrun=0);
 		
 		// INT1_CFG register, r/w
 		void setInterruptCombination(bool combination);
@@ -358,6 +370,7 @@ class L3G4200D {
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        bool 	endianMode;
 };
 
 #endif /* _L3G4200D_H_ */
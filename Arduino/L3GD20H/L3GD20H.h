@@ -184,6 +184,17 @@ THE SOFTWARE.
 #define L3GD20H_FIFO_FSS_BIT      	 4
 #define L3GD20H_FIFO_FSS_LENGTH   	 5
 
+#define L3GD20H_FIFO_DEPTH       32
+
+// whole frames per burst read, limited by the Wire library receive buffer
+#ifndef L3GD20H_FIFO_BURST_FRAMES
+#ifdef BUFFER_LENGTH
+#define L3GD20H_FIFO_BURST_FRAMES (BUFFER_LENGTH / 6)
+#else
+#define L3GD20H_FIFO_BURST_FRAMES 5
+#endif
+#endif
+
 #define L3GD20H_AND_OR_BIT   	  7
 #define L3GD20H_LIR_BIT      	  6
 #define L3GD20H_ZHIE_BIT          5
@@ -326,6 +337,7 @@ class L3GD20H {
 		bool getFIFOOverrun();
 		bool getFIFOEmpty();
 		uint8_t getFIFOStoredDataLevel();
+		uint8_t getFIFOAngularVelocity(int16_t* data, uint8_t maxFrames, bool* overrun=0);
 		
 		// IG_CFG register, r/w
 		void setInterruptCombination(bool combination);
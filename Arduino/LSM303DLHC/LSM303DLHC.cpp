@@ -1167,6 +1167,53 @@ uint8_t LSM303DLHC::getAccelFIFOStoredSamples() {
     return buffer[0];
 }
 
+/** Drain the accelerometer FIFO and average its contents
+ * FIFO_SRC_REG_A is read once, then all stored samples are read with
+ * auto-increment bursts from OUT_X_L_A, which wraps through the FIFO slots.
+ * Each burst holds at most LSM303DLHC_FIFO_BURST_FRAMES whole samples.
+ * Averaging every sample taken since the previous call lowers the noise of a
+ * tilt estimate that is updated at a lower rate than the accelerometer ODR.
+ * @param x 16-bit integer container for the mean X-axis acceleration
+ * @param y 16-bit integer container for the mean Y-axis acceleration
+ * @param z 16-bit integer container for the mean Z-axis acceleration
+ * @return Number of samples averaged; outputs are unchanged if 0
+ * @see LSM303DLHC_RA_FIFO_SRC_REG_A
+ * @see LSM303DLHC_FIFO_BURST_FRAMES
+ */
+uint8_t LSM303DLHC::getAccelerationFIFOAverage(int16_t* x, int16_t* y, int16_t* z) {
+    uint8_t raw[LSM303DLHC_FIFO_BURST_FRAMES * 6];
+    int32_t sum[3] = { 0, 0, 0 };
+    uint8_t count;
+
+    I2Cdev::readByte(devAddrA, LSM303DLHC_RA_FIFO_SRC_REG_A, buffer);
+    if (buffer[0] & (1 << LSM303DLHC_EMPTY_BIT)) {
+        count = 0;
+    } else if (buffer[0] & (1 << LSM303DLHC_OVRN_FIFO_BIT)) {
+        count = LSM303DLHC_FIFO_DEPTH; // FSS saturates below the full level
+    } else {
+        count = buffer[0] & ((1 << LSM303DLHC_FSS_LENGTH) - 1);
+    }
+    if (count == 0) return 0;
+
+    for (uint8_t done = 0; done < count; ) {
+        uint8_t frames = count - done;
+        if (frames > LSM303DLHC_FIFO_BURST_FRAMES) frames = LSM303DLHC_FIFO_BURST_FRAMES;
+        I2Cdev::readBytes(devAddrA, LSM303DLHC_RA_OUT_X_L_A | 0x80, frames * 6, raw);
+        for (uint8_t i = 0; i < frames * 3; i++) {
+            if (endianMode == LSM303DLHC_LITTLE_ENDIAN) {
+                sum[i % 3] += (int16_t)((((int16_t)raw[i * 2 + 1]) << 8) | raw[i * 2]);
+            } else {
+                sum[i % 3] += (int16_t)((((int16_t)raw[i * 2]) << 8) | raw[i * 2 + 1]);
+            }
+        }
+        done += frames;
+    }
+    *x = sum[0] / count;
+    *y = sum[1] / count;
+    *z = sum[2] / count;
+    return count;
+}
+
 //INT1_CFG_A, w/r
 
 /** Set the combination mode for interrupt 1events
@@ -240,6 +240,17 @@ THE SOFTWARE.
 #define LSM303DLHC_FSS_BIT              4
 #define LSM303DLHC_FSS_LENGTH           5
 
+#define LSM303DLHC_FIFO_DEPTH           32
+
+// whole frames per FIFO burst read, limited by the Wire library receive buffer
+#ifndef LSM303DLHC_FIFO_BURST_FRAMES
+#ifdef BUFFER_LENGTH
+#define LSM303DLHC_FIFO_BURST_FRAMES    (BUFFER_LENGTH / 6)
+#else
+#define LSM303DLHC_FIFO_BURST_FRAMES    5
+#endif
+#endif
+
 //INT1_CFG_A
 #define LSM303DLHC_INT1_AOI_BIT              7
 #define LSM303DLHC_INT1_6D_BIT               6
@@ -509,6 +520,7 @@ class LSM303DLHC {
         bool getAccelFIFOOverrun();
         bool getAccelFIFOEmpty();
         uint8_t getAccelFIFOStoredSamples();
+        uint8_t getAccelerationFIFOAverage(int16_t* x, int16_t* y, int16_t* z);
         
         //Int1_CFG_A, wr
         void setAccelInterrupt1Combination(bool combination);
@@ -0,0 +1,270 @@
+// I2Cdev library collection - LSM303DLHC tilt-compensated compass
+// Samples accelerometer and magnetometer together at the magnetometer output
+// rate and computes a calibrated heading with integer math only
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "LSM303DLHC_Compass.h"
+
+#ifdef __AVR__
+    #include <avr/pgmspace.h>
+#else
+    #ifndef PROGMEM
+        #define PROGMEM
+    #endif
+    #ifndef pgm_read_word
+        #define pgm_read_word(addr) (*(const unsigned short *)(addr))
+    #endif
+#endif
+
+// atan(i / 32) in hundredths of a degree for i = 0 ... 32
+static const uint16_t lsm303dlhcAtanTable[33] PROGMEM = {
+    0, 179, 358, 536, 713, 888, 1062, 1234, 1404, 1571, 1735, 1897, 2056,
+    2211, 2363, 2511, 2657, 2798, 2936, 3070, 3201, 3327, 3451, 3571, 3687,
+    3800, 3909, 4016, 4119, 4218, 4315, 4409, 4500
+};
+
+/** Create a compass for an already initialized device.
+ * Calibration starts out as identity (no hard- or soft-iron correction).
+ * @param device Device to sample, must stay valid for the lifetime of the compass
+ */
+LSM303DLHCCompass::LSM303DLHCCompass(LSM303DLHC *device) {
+    this->device = device;
+    for (uint8_t i = 0; i < 3; i++) {
+        hardIron[i] = 0;
+        accel[i] = 0;
+        mag[i] = 0;
+    }
+    for (uint8_t i = 0; i < 9; i++) softIron[i] = (i % 4 == 0) ? LSM303DLHC_COMPASS_ONE : 0;
+    fifoEnabled = false;
+    period = 0;
+    heading = 0;
+}
+
+/** Set the hard-iron offset subtracted from every magnetometer sample.
+ * Typically the center of the raw magnetometer readings over a full rotation.
+ * @param x X-axis offset in raw magnetometer units
+ * @param y Y-axis offset in raw magnetometer units
+ * @param z Z-axis offset in raw magnetometer units
+ */
+void LSM303DLHCCompass::setHardIron(int16_t x, int16_t y, int16_t z) {
+    hardIron[0] = x;
+    hardIron[1] = y;
+    hardIron[2] = z;
+}
+
+/** Set the soft-iron matrix applied after the hard-iron offset.
+ * The matrix maps the offset ellipsoid of raw readings back to a sphere. It
+ * can also absorb the different X/Y and Z gains of the magnetometer.
+ * @param matrix 3x3 matrix in row-major order, Q12 fixed point
+ * @see LSM303DLHC_COMPASS_ONE
+ */
+void LSM303DLHCCompass::setSoftIron(const int16_t *matrix) {
+    for (uint8_t i = 0; i < 9; i++) softIron[i] = matrix[i];
+}
+
+/** Start sampling at the magnetometer output data rate.
+ * The magnetometer rate and the accelerometer FIFO setting are read once here.
+ * Call this again after changing either of them.
+ */
+void LSM303DLHCCompass::begin() {
+    switch (device->getMagOutputDataRate()) {
+        case 0:   period = 1333333; break;
+        case 1:   period = 666667; break;
+        case 3:   period = 333333; break;
+        case 7:   period = 133333; break;
+        case 15:  period = 66667; break;
+        case 30:  period = 33333; break;
+        case 75:  period = 13333; break;
+        default:  period = 4545; break;
+    }
+    fifoEnabled = device->getAccelFIFOEnabled();
+    lastSample = micros() - period;
+}
+
+/** Take a new accelerometer and magnetometer sample if one is due.
+ * Never blocks. Once per magnetometer output period the accelerometer is read
+ * first, then the magnetometer. With the accelerometer FIFO enabled, all
+ * accelerometer samples queued since the previous call are drained in bursts
+ * and averaged. Otherwise a single 6-byte read is made. The heading is then
+ * recomputed.
+ * @return True if a new heading was computed
+ */
+bool LSM303DLHCCompass::service() {
+    uint32_t now = micros();
+    if (now - lastSample < period) return false;
+    // keep the cadence unless a whole period was missed
+    lastSample = (now - lastSample < 2 * period) ? lastSample + period : now;
+
+    if (fifoEnabled) {
+        // an empty FIFO keeps the previous accelerometer reading
+        device->getAccelerationFIFOAverage(&accel[0], &accel[1], &accel[2]);
+    } else {
+        device->getAcceleration(&accel[0], &accel[1], &accel[2]);
+    }
+    device->getMag(&mag[0], &mag[1], &mag[2]);
+    heading = computeHeading(accel[0], accel[1], accel[2], mag[0], mag[1], mag[2]);
+    return true;
+}
+
+/** Get the most recent heading.
+ * @return Heading of the X axis clockwise from magnetic north, in hundredths
+ *         of a degree (0 ... 35999)
+ */
+uint16_t LSM303DLHCCompass::getHeading() {
+    return heading;
+}
+
+/** Get the time the most recent sample was due.
+ * @return micros() timestamp on the magnetometer output period grid
+ */
+uint32_t LSM303DLHCCompass::getTimestamp() {
+    return lastSample;
+}
+
+/** Get the accelerometer reading the most recent heading was computed from.
+ * @param x 16-bit integer container for the X-axis acceleration
+ * @param y 16-bit integer container for the Y-axis acceleration
+ * @param z 16-bit integer container for the Z-axis acceleration
+ */
+void LSM303DLHCCompass::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
+    *x = accel[0];
+    *y = accel[1];
+    *z = accel[2];
+}
+
+/** Get the raw magnetometer reading the most recent heading was computed from.
+ * @param x 16-bit integer container for the X-axis magnetic field
+ * @param y 16-bit integer container for the Y-axis magnetic field
+ * @param z 16-bit integer container for the Z-axis magnetic field
+ */
+void LSM303DLHCCompass::getMag(int16_t* x, int16_t* y, int16_t* z) {
+    *x = mag[0];
+    *y = mag[1];
+    *z = mag[2];
+}
+
+/** Compute a tilt-compensated heading from raw readings.
+ * The magnetometer vector is corrected with the hard- and soft-iron
+ * calibration. East is then the cross product of the magnetic field and the
+ * gravity vector, and north is the cross product of gravity and east. The
+ * heading is the angle of the X axis between those two horizontal vectors.
+ * This needs no sine, cosine or floating point, only 32-bit multiplies, one
+ * integer square root and one table-driven atan2.
+ * @param ax Raw X-axis acceleration (left-justified, as from getAcceleration())
+ * @param ay Raw Y-axis acceleration
+ * @param az Raw Z-axis acceleration
+ * @param mx Raw X-axis magnetic field (as from getMag())
+ * @param my Raw Y-axis magnetic field
+ * @param mz Raw Z-axis magnetic field
+ * @return Heading of the X axis clockwise from magnetic north, in hundredths
+ *         of a degree (0 ... 35999)
+ */
+uint16_t LSM303DLHCCompass::computeHeading(int16_t ax, int16_t ay, int16_t az, int16_t mx, int16_t my, int16_t mz) {
+    int32_t b[3] = { (int32_t)mx - hardIron[0], (int32_t)my - hardIron[1], (int32_t)mz - hardIron[2] };
+    int32_t m[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        m[i] = (softIron[i * 3] * b[0] + softIron[i * 3 + 1] * b[1] + softIron[i * 3 + 2] * b[2]) >> 12;
+    }
+
+    // 12-bit accelerometer data is left-justified
+    int32_t a[3] = { ax >> 4, ay >> 4, az >> 4 };
+
+    // east = m x a, scaled down to 16 bits so that north = a x east fits 32 bits
+    int32_t e0 = m[1] * a[2] - m[2] * a[1];
+    int32_t e1 = m[2] * a[0] - m[0] * a[2];
+    int32_t e2 = m[0] * a[1] - m[1] * a[0];
+    while (e0 > 32767 || e0 < -32767 || e1 > 32767 || e1 < -32767 || e2 > 32767 || e2 < -32767) {
+        e0 >>= 1;
+        e1 >>= 1;
+        e2 >>= 1;
+    }
+    int32_t n0 = a[1] * e2 - a[2] * e1;
+
+    // |north| = |a| * |east|, so scale east by |a| to compare the two
+    uint16_t g = isqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+    return atan2CentiDeg(e0 * g, n0);
+}
+
+/** Four-quadrant arctangent with integer math.
+ * The ratio of the smaller to the larger magnitude is reduced to Q15 with one
+ * division and looked up in a 33-entry table with linear interpolation, which
+ * is accurate to better than 0.02 degree.
+ * @param y Coordinate along the 90 degree direction
+ * @param x Coordinate along the 0 degree direction
+ * @return Angle from x towards y in hundredths of a degree (0 ... 35999)
+ */
+uint16_t LSM303DLHCCompass::atan2CentiDeg(int32_t y, int32_t x) {
+    uint32_t ux = x < 0 ? -(uint32_t)x : x;
+    uint32_t uy = y < 0 ? -(uint32_t)y : y;
+    if (ux == 0 && uy == 0) return 0;
+
+    bool swap = uy > ux;
+    uint32_t num = swap ? ux : uy;
+    uint32_t den = swap ? uy : ux;
+    while (den > 0xFFFF) {
+        num >>= 1;
+        den >>= 1;
+    }
+    uint16_t ratio = (num << 15) / den;
+    uint8_t index = ratio >> 10;
+    int32_t angle;
+    if (index >= 32) {
+        angle = 4500;
+    } else {
+        uint16_t t0 = pgm_read_word(&lsm303dlhcAtanTable[index]);
+        uint16_t t1 = pgm_read_word(&lsm303dlhcAtanTable[index + 1]);
+        angle = t0 + (((int32_t)(t1 - t0) * (ratio & 0x3FF)) >> 10);
+    }
+
+    if (swap) angle = 9000 - angle;
+    if (x < 0) angle = 18000 - angle;
+    if (y < 0) angle = 36000 - angle;
+    if (angle >= 36000) angle -= 36000;
+    return angle;
+}
+
+/** Integer square root.
+ * @param value Radicand
+ * @return Largest integer whose square does not exceed value
+ */
+uint16_t LSM303DLHCCompass::isqrt(uint32_t value) {
+    uint32_t result = 0;
+    uint32_t bit = (uint32_t)1 << 30;
+    while (bit > value) bit >>= 2;
+    while (bit) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
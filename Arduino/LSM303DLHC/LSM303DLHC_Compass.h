@@ -0,0 +1,72 @@
+// I2Cdev library collection - LSM303DLHC tilt-compensated compass
+// Samples accelerometer and magnetometer together at the magnetometer output
+// rate and computes a calibrated heading with integer math only
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _LSM303DLHC_COMPASS_H_
+#define _LSM303DLHC_COMPASS_H_
+
+#include "LSM303DLHC.h"
+
+// soft-iron matrix entries are Q12 fixed point (4096 = 1.0)
+#define LSM303DLHC_COMPASS_ONE      4096
+
+class LSM303DLHCCompass {
+    public:
+        LSM303DLHCCompass(LSM303DLHC *device);
+
+        void setHardIron(int16_t x, int16_t y, int16_t z);
+        void setSoftIron(const int16_t *matrix);
+
+        void begin();
+        bool service();
+
+        uint16_t getHeading();
+        uint32_t getTimestamp();
+        void getAcceleration(int16_t* x, int16_t* y, int16_t* z);
+        void getMag(int16_t* x, int16_t* y, int16_t* z);
+
+        uint16_t computeHeading(int16_t ax, int16_t ay, int16_t az, int16_t mx, int16_t my, int16_t mz);
+        static uint16_t atan2CentiDeg(int32_t y, int32_t x);
+
+    private:
+        static uint16_t isqrt(uint32_t value);
+
+        LSM303DLHC *device;
+        int16_t hardIron[3];
+        int16_t softIron[9];
+        bool fifoEnabled;
+        uint32_t period;
+        uint32_t lastSample;
+        int16_t accel[3];
+        int16_t mag[3];
+        uint16_t heading;
+};
+
+#endif /* _LSM303DLHC_COMPASS_H_ */
@@ -37,7 +37,11 @@ THE SOFTWARE.
 #include "I2Cdev.h"
 
 MPR121::MPR121(uint8_t address) :
-  m_devAddr(address)
+  m_devAddr(address),
+  m_prevTouchStatus(0),
+  m_touchedSeen(0),
+  m_releasedSeen(0),
+  m_irqPin(-1)
 {
   for (int ch = 0; ch < NUM_CHANNELS; ch++) {
     m_callbackMap[ch][TOUCHED] = 0;
@@ -184,38 +188,83 @@ bool MPR121::testConnection() {
 }
 
 bool MPR121::getTouchStatus(uint8_t channel) {
-  const uint8_t statusReg = (channel < 8) ? ELE0_ELE7_TOUCH_STATUS : ELE8_ELE11_ELEPROX_TOUCH_STATUS;
-  uint8_t buf = 0;
-  I2Cdev::readByte(m_devAddr, statusReg, &buf);
-  const bool touchActive = (channel < 8) ? (buf & (1 << channel)) > 0 : (buf & (1 << (channel - 8))) > 0;
-  return touchActive;
+  // a read of either status register releases the IRQ output, so go through
+  // the full read to keep the change tracking in step
+  return (getTouchStatus() & (1 << channel)) != 0;
 }
 
 uint16_t MPR121::getTouchStatus() {
-  uint16_t statusBuf;
-  uint8_t buf;
-  I2Cdev::readByte(m_devAddr, ELE0_ELE7_TOUCH_STATUS, &buf);
-  statusBuf = buf;
-  I2Cdev::readByte(m_devAddr, ELE8_ELE11_ELEPROX_TOUCH_STATUS, &buf);
-  statusBuf += (buf << 8);
-  return statusBuf;
+  // both status registers in one read; this also clears the IRQ output
+  uint8_t buf[2] = { 0, 0 };
+  if (I2Cdev::readBytes(m_devAddr, ELE0_ELE7_TOUCH_STATUS, 2, buf) != 2) {
+    return 0;
+  }
+  const uint16_t touchStatus = buf[0] | ((uint16_t)buf[1] << 8);
+  trackTouchStatus(touchStatus & CHANNEL_MASK);
+  return touchStatus;
+}
+
+// records which channels were touched and which were released since the last
+// read status. the IRQ output only reflects changes nobody has read yet, so
+// these are kept until serviceCallbacks dispatches them. a touch and a release
+// seen between two calls are both kept, not cancelled out.
+void MPR121::trackTouchStatus(uint16_t touchStatus) {
+  m_touchedSeen |= touchStatus & ~m_prevTouchStatus;
+  m_releasedSeen |= m_prevTouchStatus & ~touchStatus;
+  m_prevTouchStatus = touchStatus;
 }
 
 void MPR121::setCallback(uint8_t channel, EventType event, CallbackPtrType callbackPtr) {
   m_callbackMap[channel][event] = callbackPtr;
 }
     
-void MPR121::serviceCallbacks() {
+void MPR121::setInterruptPin(int8_t pin) {
+  m_irqPin = pin;
+  if (pin >= 0) {
+    pinMode(pin, INPUT_PULLUP);
+  }
+}
+
+uint16_t MPR121::serviceCallbacks() {
+  // nothing changed since the last read if the IRQ output is released, but
+  // getTouchStatus may have read (and released) changes in the meantime
+  const bool released = m_irqPin >= 0 && digitalRead(m_irqPin) == HIGH;
+  if (released && (m_touchedSeen | m_releasedSeen) == 0) {
+    return 0;
+  }
+
+  if (!released) {
+    uint8_t buf[2];
+    if (I2Cdev::readBytes(m_devAddr, ELE0_ELE7_TOUCH_STATUS, 2, buf) != 2) {
+      return 0;
+    }
+    trackTouchStatus((buf[0] | ((uint16_t)buf[1] << 8)) & CHANNEL_MASK);
+  }
+  const uint16_t touchStatus = m_prevTouchStatus;
+  const uint16_t touchedSeen = m_touchedSeen;
+  const uint16_t releasedSeen = m_releasedSeen;
+  m_touchedSeen = 0;
+  m_releasedSeen = 0;
+
   for (uint8_t channel = 0; channel < NUM_CHANNELS; channel++) { 
-    bool touchStatus = getTouchStatus(channel);
-    if (touchStatus != m_prevTouchStatus[channel]) {
-      for (uint8_t type = 0; type < NUM_EVENTS; type++) { 
-        const CallbackPtrType cb = touchStatus ? m_callbackMap[channel][TOUCHED] : m_callbackMap[channel][RELEASED]; 
-        if (cb != 0) {
-          cb();           
-        }
-      }
-      m_prevTouchStatus[channel] = touchStatus; 
+    const uint16_t bit = 1 << channel;
+    // with both seen, the event matching the current state came last
+    if ((releasedSeen & bit) && (touchStatus & bit)) {
+      dispatch(channel, RELEASED);
+    }
+    if (touchedSeen & bit) {
+      dispatch(channel, TOUCHED);
     }
+    if ((releasedSeen & bit) && !(touchStatus & bit)) {
+      dispatch(channel, RELEASED);
+    }
+  }
+  return touchedSeen | releasedSeen;
+}
+
+void MPR121::dispatch(uint8_t channel, EventType event) {
+  const CallbackPtrType cb = m_callbackMap[channel][event];
+  if (cb != 0) {
+    cb();
   }
 }
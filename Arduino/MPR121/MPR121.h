@@ -183,6 +183,7 @@ THE SOFTWARE.
 #define TOUCH_THRESHOLD   0x0F
 #define RELEASE_THRESHOLD 0x0A
 #define NUM_CHANNELS      12
+#define CHANNEL_MASK      0x0FFF // ELE0 - ELE11 bits of the 16-bit touch status
 
 class MPR121
 {
@@ -208,16 +209,34 @@ class MPR121
     // getTouchStatus returns the touch status for the given channel (0 - 11)
     bool getTouchStatus(uint8_t channel);
     // when not given a channel, returns a bitfield of all touch channels.
+    // reading the status releases the IRQ output; the changes it saw are
+    // kept and still reported by the next serviceCallbacks call.
     uint16_t getTouchStatus();
 
     void setCallback(uint8_t channel, EventType event, CallbackPtrType callbackPtr);
     
-    void serviceCallbacks();
+    // the IRQ output (active low, open drain) is asserted on every touch status
+    // change and released when the status is read. with a pin set, 
+    // serviceCallbacks only reads the device while the pin is low.
+    // pass -1 to read on every call (the default).
+    void setInterruptPin(int8_t pin);
+
+    // reads the touch status once and calls the TOUCHED and RELEASED callbacks
+    // for every change seen since the last call, in the order they happened
+    // (a quick tap between two calls gives TOUCHED, then RELEASED).
+    // returns the bitfield of changed channels.
+    uint16_t serviceCallbacks();
     
   private:
+    void trackTouchStatus(uint16_t touchStatus);
+    void dispatch(uint8_t channel, EventType event);
+
     uint8_t m_devAddr; // contains the I2C address of the device
     CallbackPtrType m_callbackMap[NUM_CHANNELS][NUM_EVENTS];
-    bool m_prevTouchStatus[NUM_CHANNELS];
+    uint16_t m_prevTouchStatus; // channel bitfield as of the last status read
+    uint16_t m_touchedSeen; // channels touched but not yet dispatched
+    uint16_t m_releasedSeen; // channels released but not yet dispatched
+    int8_t m_irqPin;
     
 };
 
@@ -0,0 +1,212 @@
+// I2Cdev library collection - MPU6050 interrupt-driven acquisition
+// Time-stamps data-ready and DMP/FIFO interrupts in the INT pin ISR and defers
+// the register or FIFO read to a service routine that feeds a lock-free queue
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050_ACQUISITION_H_
+#define _MPU6050_ACQUISITION_H_
+
+#include "MPU6050.h"
+#include "I2Cdev_Acquisition.h"
+
+// queue depths, must be powers of two
+#ifndef MPU6050_ACQUISITION_QUEUE_SIZE
+#define MPU6050_ACQUISITION_QUEUE_SIZE      8
+#endif
+#ifndef MPU6050_ACQUISITION_PENDING_SIZE
+#define MPU6050_ACQUISITION_PENDING_SIZE    4
+#endif
+#ifndef MPU6050_ACQUISITION_FIFO_QUEUE_SIZE
+#define MPU6050_ACQUISITION_FIFO_QUEUE_SIZE 4
+#endif
+
+// largest FIFO packet queued by MPU6050FIFOAcquisition (MotionApps 2.0 packets
+// are 42 bytes, define this as 48 before including for MotionApps 4.1)
+#ifndef MPU6050_ACQUISITION_PACKET_SIZE
+#define MPU6050_ACQUISITION_PACKET_SIZE     42
+#endif
+
+/** One data-ready sample with the time its interrupt was raised. */
+struct MPU6050Sample {
+    uint32_t timestamp;     // micros() captured in the INT pin ISR
+    uint8_t intStatus;      // INT_STATUS read together with the data
+    int16_t ax, ay, az;
+    int16_t temperature;
+    int16_t gx, gy, gz;
+
+    template <typename Device>
+    static bool read(Device *device, MPU6050Sample *sample);
+};
+
+/** One FIFO packet with the time its interrupt was raised. */
+struct MPU6050FIFOSample {
+    uint32_t timestamp;     // micros() captured in the INT pin ISR
+    uint8_t intStatus;      // INT_STATUS from the last FIFO count refresh
+    uint8_t data[MPU6050_ACQUISITION_PACKET_SIZE];
+};
+
+template <typename WIRE>
+class MPU6050Acquisition : public I2CdevAcquisition<MPU6050<WIRE>, MPU6050Sample,
+        MPU6050_ACQUISITION_QUEUE_SIZE, MPU6050_ACQUISITION_PENDING_SIZE> {
+    public:
+        MPU6050Acquisition(MPU6050<WIRE> *device);
+
+        void initialize();
+};
+
+template <typename WIRE>
+class MPU6050FIFOAcquisition : public I2CdevAcquisition<MPU6050<WIRE>, MPU6050FIFOSample,
+        MPU6050_ACQUISITION_FIFO_QUEUE_SIZE, MPU6050_ACQUISITION_PENDING_SIZE> {
+    public:
+        MPU6050FIFOAcquisition(MPU6050<WIRE> *device);
+
+        void initialize(uint8_t packetSize);
+        uint8_t service();
+
+    private:
+        uint8_t packetSize;
+        uint8_t lastIsrDropped;
+};
+
+/** Burst-read INT_STATUS, accel, temperature and gyro in one transaction.
+ * @param device Device to read from
+ * @param sample Container for the data
+ * @return True if DATA_RDY was set, false if the registers were already read
+ */
+template <typename Device>
+bool MPU6050Sample::read(Device *device, MPU6050Sample *sample) {
+    sample->intStatus = device->getIntStatusAndMotion6(&sample->ax, &sample->ay, &sample->az,
+        &sample->gx, &sample->gy, &sample->gz, &sample->temperature);
+    return (sample->intStatus & (1 << MPU6050_INTERRUPT_DATA_RDY_BIT)) != 0;
+}
+
+/** Create an acquisition driver for an already initialized device.
+ * @param device Device whose INT pin is attached to an interrupt that calls
+ *        handleInterrupt()
+ */
+template <typename WIRE>
+MPU6050Acquisition<WIRE>::MPU6050Acquisition(MPU6050<WIRE> *device)
+    : I2CdevAcquisition<MPU6050<WIRE>, MPU6050Sample,
+        MPU6050_ACQUISITION_QUEUE_SIZE, MPU6050_ACQUISITION_PENDING_SIZE>(device) {
+}
+
+/** Configure the INT pin for data-ready acquisition.
+ * The pin is set up as an active-high, push-pull 50us pulse that is cleared by
+ * reading INT_STATUS, and the data-ready interrupt is the only one enabled. The
+ * sample rate itself is left as configured (see MPU6050::setRate()). Attach the
+ * ISR on a RISING edge after calling this.
+ */
+template <typename WIRE>
+void MPU6050Acquisition<WIRE>::initialize() {
+    this->device->setInterruptMode(MPU6050_INTMODE_ACTIVEHIGH);
+    this->device->setInterruptDrive(MPU6050_INTDRV_PUSHPULL);
+    this->device->setInterruptLatch(MPU6050_INTLATCH_50USPULSE);
+    this->device->setInterruptLatchClear(MPU6050_INTCLEAR_STATUSREAD);
+    this->device->setIntEnabled(1 << MPU6050_INTERRUPT_DATA_RDY_BIT);
+    this->device->getIntStatus();
+    this->reset();
+}
+
+/** Create a FIFO acquisition driver for an already initialized device.
+ * @param device Device whose INT pin is attached to an interrupt that calls
+ *        handleInterrupt()
+ */
+template <typename WIRE>
+MPU6050FIFOAcquisition<WIRE>::MPU6050FIFOAcquisition(MPU6050<WIRE> *device)
+    : I2CdevAcquisition<MPU6050<WIRE>, MPU6050FIFOSample,
+        MPU6050_ACQUISITION_FIFO_QUEUE_SIZE, MPU6050_ACQUISITION_PENDING_SIZE>(device) {
+    packetSize = 0;
+    lastIsrDropped = 0;
+}
+
+/** Start FIFO acquisition with the given packet size.
+ * The interrupt configuration is left as it is, so this works with the DMP
+ * setup from dmpInitialize() as well as with a plain FIFO whose interrupt is
+ * raised once per packet. The FIFO is reset so that the first packet read
+ * belongs to the first interrupt recorded afterwards. Attach the ISR on a
+ * RISING edge after calling this.
+ * @param packetSize Packet size in bytes (e.g. dmpGetFIFOPacketSize()), at
+ *        most MPU6050_ACQUISITION_PACKET_SIZE
+ */
+template <typename WIRE>
+void MPU6050FIFOAcquisition<WIRE>::initialize(uint8_t packetSize) {
+    if (packetSize > MPU6050_ACQUISITION_PACKET_SIZE) packetSize = MPU6050_ACQUISITION_PACKET_SIZE;
+    this->packetSize = packetSize;
+    this->device->resetFIFO();
+    this->device->getIntStatus();
+    lastIsrDropped = this->isrDropped;
+    this->reset();
+}
+
+/** Read one FIFO packet per interrupt recorded since the last call.
+ * Unlike the data registers the FIFO keeps every packet, so each pending
+ * stamp is paired with the next packet in order, using
+ * MPU6050::pollFIFOPacket() (INT_STATUS and FIFO_COUNT are only read when the
+ * locally tracked count runs short). A stamp whose packet is not complete yet
+ * stays pending for the next call. If the sample queue is full the packet is
+ * still read, to keep packets and stamps aligned, and counted as dropped.
+ *
+ * On a FIFO overflow the FIFO is reset and all pending stamps are dropped. If
+ * the ISR had to drop stamps since the last call, packets and stamps can no
+ * longer be matched, so the FIFO and the pending stamps are discarded as well.
+ * @return Number of packets added to the queue
+ */
+template <typename WIRE>
+uint8_t MPU6050FIFOAcquisition<WIRE>::service() {
+    if (this->isrDropped != lastIsrDropped) {
+        lastIsrDropped = this->isrDropped;
+        uint32_t timestamp;
+        while (this->pending.pop(&timestamp)) this->serviceDropped++;
+        this->device->resetFIFO();
+        return 0;
+    }
+
+    uint8_t count = 0;
+    uint32_t timestamp;
+    MPU6050FIFOSample s;
+    while (this->pending.peek(&timestamp)) {
+        s.intStatus = 0;
+        int8_t result = this->device->pollFIFOPacket(s.data, packetSize, &s.intStatus);
+        if (result == 0) break;
+        if (result < 0) {
+            while (this->pending.pop(&timestamp)) this->serviceDropped++;
+            break;
+        }
+        this->pending.pop(&timestamp);
+        s.timestamp = timestamp;
+        if (this->samples.push(s)) {
+            count++;
+        } else {
+            this->serviceDropped++;
+        }
+    }
+    return count;
+}
+
+#endif /* _MPU6050_ACQUISITION_H_ */
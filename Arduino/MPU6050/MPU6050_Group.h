@@ -0,0 +1,210 @@
+// I2Cdev library collection - MPU6050 synchronized multi-device acquisition group
+// Reads several MPU6050s (AD0_LOW/AD0_HIGH, one or more buses) back-to-back and
+// stamps every sample with its measured read time
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050_GROUP_H_
+#define _MPU6050_GROUP_H_
+
+#include "MPU6050.h"
+
+// two devices per bus (AD0 low/high) on two buses
+#ifndef MPU6050_GROUP_MAX_DEVICES
+#define MPU6050_GROUP_MAX_DEVICES   4
+#endif
+
+/** One time-stamped 6-axis sample of a single group member. */
+struct MPU6050Frame {
+    int16_t ax, ay, az;
+    int16_t gx, gy, gz;
+    uint32_t timestamp;     // micros() at the middle of the burst read
+};
+
+/** One sample of every group member, taken in a single acquisition pass. */
+struct MPU6050FrameSet {
+    MPU6050Frame frames[MPU6050_GROUP_MAX_DEVICES];
+    uint8_t count;
+    uint32_t timestamp;     // common reference time (mean of the member stamps)
+    uint32_t skew;          // time between the first and the last member stamp
+};
+
+template <typename WIRE>
+class MPU6050Group {
+    public:
+        MPU6050Group();
+
+        bool addDevice(MPU6050<WIRE> *device);
+        uint8_t getDeviceCount();
+        MPU6050<WIRE> *getDevice(uint8_t index);
+
+        void initialize(uint8_t rate, uint8_t dlpfMode, uint8_t frameSync=MPU6050_EXT_SYNC_DISABLED);
+
+        void sample(MPU6050FrameSet *set, bool aligned=false);
+
+    private:
+        static int16_t extrapolate(int16_t value, int16_t lastValue, int32_t offset, int32_t dt);
+
+        MPU6050<WIRE> *devices[MPU6050_GROUP_MAX_DEVICES];
+        uint8_t deviceCount;
+        MPU6050Frame last[MPU6050_GROUP_MAX_DEVICES];
+        bool hasLast;
+};
+
+/** Move a sample value along its last-known slope to a reference time.
+ * @param value Current value, sampled at t
+ * @param lastValue Previous value, sampled dt microseconds before t
+ * @param offset Reference time minus t, in microseconds (may be negative)
+ * @param dt Time between the previous and the current sample, in microseconds
+ * @return Extrapolated value, saturated to the int16_t range
+ */
+template <typename WIRE>
+int16_t MPU6050Group<WIRE>::extrapolate(int16_t value, int16_t lastValue, int32_t offset, int32_t dt) {
+    int32_t v = value + ((int32_t)(value - lastValue) * offset) / dt;
+    if (v > 32767) return 32767;
+    if (v < -32768) return -32768;
+    return v;
+}
+
+/** Default constructor, creates an empty group.
+ * @see addDevice()
+ */
+template <typename WIRE>
+MPU6050Group<WIRE>::MPU6050Group() {
+    deviceCount = 0;
+    hasLast = false;
+}
+
+/** Add a device to the group.
+ * Devices are read in the order they were added. The device must already be
+ * initialized and stay valid for the lifetime of the group.
+ * @param device Device to add
+ * @return True if added, false if the group is full
+ * @see MPU6050_GROUP_MAX_DEVICES
+ */
+template <typename WIRE>
+bool MPU6050Group<WIRE>::addDevice(MPU6050<WIRE> *device) {
+    if (deviceCount >= MPU6050_GROUP_MAX_DEVICES) return false;
+    devices[deviceCount++] = device;
+    hasLast = false;
+    return true;
+}
+
+/** Get the number of devices in the group.
+ * @return Number of devices added so far
+ */
+template <typename WIRE>
+uint8_t MPU6050Group<WIRE>::getDeviceCount() {
+    return deviceCount;
+}
+
+/** Get a group member.
+ * @param index Position in the group (order of addDevice() calls)
+ * @return Device pointer, or 0 if index is out of range
+ */
+template <typename WIRE>
+MPU6050<WIRE> *MPU6050Group<WIRE>::getDevice(uint8_t index) {
+    return index < deviceCount ? devices[index] : 0;
+}
+
+/** Apply a shared sample-rate configuration to every member.
+ * All devices get the same SMPLRT_DIV, DLPF and FSYNC settings so that they
+ * produce samples at the same rate and with the same filter group delay. When
+ * the FSYNC pins are wired together, frameSync latches the common sync pulse
+ * into the LSB of the selected output register of every device.
+ * @param rate Sample rate divider (see MPU6050::setRate())
+ * @param dlpfMode DLPF bandwidth setting (see MPU6050::setDLPFMode())
+ * @param frameSync FSYNC latch location (see MPU6050::setExternalFrameSync())
+ * @see MPU6050_EXT_SYNC_DISABLED
+ */
+template <typename WIRE>
+void MPU6050Group<WIRE>::initialize(uint8_t rate, uint8_t dlpfMode, uint8_t frameSync) {
+    for (uint8_t i = 0; i < deviceCount; i++) {
+        devices[i]->setRate(rate);
+        devices[i]->setDLPFMode(dlpfMode);
+        devices[i]->setExternalFrameSync(frameSync);
+    }
+    hasLast = false;
+}
+
+/** Take one time-aligned sample of every member.
+ * The 14-byte ACCEL/TEMP/GYRO bursts of all devices are issued back-to-back
+ * with nothing else in between, and each frame is stamped with the midpoint of
+ * its own read. The frame set reference time is the mean of the member stamps.
+ *
+ * When aligned is true, each frame is additionally moved to the reference time
+ * along the slope between its previous and current sample, so that the
+ * remaining read-to-read skew does not bias fusion across devices. The first
+ * call after the group changes is never aligned since no slope is known yet.
+ *
+ * @param set Frame set to fill (set->count is set to the number of devices)
+ * @param aligned Extrapolate every frame to the common reference time
+ */
+template <typename WIRE>
+void MPU6050Group<WIRE>::sample(MPU6050FrameSet *set, bool aligned) {
+    uint32_t start, end;
+    uint32_t first = 0;
+    int32_t sum = 0;
+
+    // one pass over the bus; stamps are taken around each burst only
+    for (uint8_t i = 0; i < deviceCount; i++) {
+        MPU6050Frame *f = &set->frames[i];
+        start = micros();
+        devices[i]->getMotion6(&f->ax, &f->ay, &f->az, &f->gx, &f->gy, &f->gz);
+        end = micros();
+        f->timestamp = start + (end - start) / 2;
+    }
+    set->count = deviceCount;
+
+    // relative sums keep the mean correct across micros() rollover
+    if (deviceCount > 0) first = set->frames[0].timestamp;
+    for (uint8_t i = 0; i < deviceCount; i++) sum += (int32_t)(set->frames[i].timestamp - first);
+    set->timestamp = deviceCount > 0 ? first + sum / deviceCount : micros();
+    set->skew = deviceCount > 0 ? set->frames[deviceCount - 1].timestamp - first : 0;
+
+    for (uint8_t i = 0; i < deviceCount; i++) {
+        MPU6050Frame *f = &set->frames[i];
+        MPU6050Frame *l = &last[i];
+        MPU6050Frame raw = *f;
+        int32_t dt = (int32_t)(f->timestamp - l->timestamp);
+        if (aligned && hasLast && dt > 0) {
+            int32_t offset = (int32_t)(set->timestamp - f->timestamp);
+            f->ax = extrapolate(f->ax, l->ax, offset, dt);
+            f->ay = extrapolate(f->ay, l->ay, offset, dt);
+            f->az = extrapolate(f->az, l->az, offset, dt);
+            f->gx = extrapolate(f->gx, l->gx, offset, dt);
+            f->gy = extrapolate(f->gy, l->gy, offset, dt);
+            f->gz = extrapolate(f->gz, l->gz, offset, dt);
+            f->timestamp = set->timestamp;
+        }
+        *l = raw;
+    }
+    hasLast = true;
+}
+
+#endif /* _MPU6050_GROUP_H_ */
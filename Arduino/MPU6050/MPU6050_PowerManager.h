@@ -0,0 +1,215 @@
+// I2Cdev library collection - MPU6050 wake-on-motion power management
+// Duty-cycles the accelerometer while the device is still and switches back to
+// full-rate streaming when the motion interrupt fires
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050_POWERMANAGER_H_
+#define _MPU6050_POWERMANAGER_H_
+
+#include "MPU6050.h"
+
+#define MPU6050_POWER_STREAMING         0x00
+#define MPU6050_POWER_WAKE_ON_MOTION    0x01
+
+// gyroscope start-up time (datasheet typ. 30ms) added to the wake latency bound
+#define MPU6050_GYRO_STARTUP_MS         30
+
+template <typename WIRE>
+class MPU6050PowerManager {
+    public:
+        MPU6050PowerManager(MPU6050<WIRE> *device);
+
+        void initialize(uint8_t threshold, uint8_t duration, uint8_t wakeFrequency=MPU6050_WAKE_FREQ_5, uint16_t idleTimeout=5000);
+        void setStateCallback(void (*callback)(uint8_t state));
+
+        bool update(bool interrupted=true);
+        bool processIntStatus(uint8_t intStatus);
+
+        uint8_t getState();
+        uint16_t getMaxWakeLatency();
+
+        void enterWakeOnMotion();
+        void enterStreaming();
+
+    private:
+        MPU6050<WIRE> *device;
+        void (*callback)(uint8_t state);
+        uint8_t state;
+        uint8_t duration;
+        uint8_t wakeFrequency;
+        uint8_t clockSource;
+        uint16_t idleTimeout;
+        uint32_t lastActivity;
+};
+
+/** Create a power manager for an already initialized device.
+ * @param device Device to manage
+ */
+template <typename WIRE>
+MPU6050PowerManager<WIRE>::MPU6050PowerManager(MPU6050<WIRE> *device) {
+    this->device = device;
+    callback = 0;
+    state = MPU6050_POWER_STREAMING;
+    duration = 1;
+    wakeFrequency = MPU6050_WAKE_FREQ_5;
+    clockSource = MPU6050_CLOCK_PLL_XGYRO;
+    idleTimeout = 5000;
+    lastActivity = 0;
+}
+
+/** Configure motion detection and start in streaming state.
+ * The motion interrupt is enabled and latched until INT_STATUS is read, and
+ * the accelerometer high-pass filter is set to 5Hz since motion detection
+ * works on the filtered signal. The device stays fully awake until
+ * idleTimeout milliseconds pass without a motion interrupt.
+ * @param threshold Motion threshold in 2mg/LSB (see MPU6050::setMotionDetectionThreshold())
+ * @param duration Motion duration in samples (see MPU6050::setMotionDetectionDuration())
+ * @param wakeFrequency Low-power wake rate (MPU6050_WAKE_FREQ_1P25 ... MPU6050_WAKE_FREQ_10)
+ * @param idleTimeout Milliseconds without motion before entering wake-on-motion
+ * @see MPU6050_WAKE_FREQ_5
+ */
+template <typename WIRE>
+void MPU6050PowerManager<WIRE>::initialize(uint8_t threshold, uint8_t duration, uint8_t wakeFrequency, uint16_t idleTimeout) {
+    this->duration = duration;
+    this->wakeFrequency = wakeFrequency;
+    this->idleTimeout = idleTimeout;
+    clockSource = device->getClockSource();
+    device->setDHPFMode(MPU6050_DHPF_5);
+    device->setMotionDetectionThreshold(threshold);
+    device->setMotionDetectionDuration(duration);
+    device->setInterruptLatch(MPU6050_INTLATCH_WAITCLEAR);
+    device->setIntMotionEnabled(true);
+    device->getIntStatus();
+    state = MPU6050_POWER_STREAMING;
+    lastActivity = millis();
+}
+
+/** Set a function to be called on every state change.
+ * @param callback Function receiving the new state, or 0 to disable
+ * @see MPU6050_POWER_STREAMING
+ * @see MPU6050_POWER_WAKE_ON_MOTION
+ */
+template <typename WIRE>
+void MPU6050PowerManager<WIRE>::setStateCallback(void (*callback)(uint8_t state)) {
+    this->callback = callback;
+}
+
+/** Advance the state machine.
+ * In wake-on-motion state no bus transaction is made unless interrupted is
+ * true, so a host sleeping on the INT pin only talks to the device when it
+ * actually woke up. In streaming state INT_STATUS is read to look for motion.
+ * Callers that already read INT_STATUS (e.g. in a DMP loop, which clears the
+ * motion bit) should use processIntStatus() instead.
+ * @param interrupted True if the INT pin fired since the last call
+ * @return True if the state changed
+ */
+template <typename WIRE>
+bool MPU6050PowerManager<WIRE>::update(bool interrupted) {
+    if (state == MPU6050_POWER_WAKE_ON_MOTION && !interrupted) return false;
+    return processIntStatus(device->getIntStatus());
+}
+
+/** Advance the state machine from an INT_STATUS value read elsewhere.
+ * @param intStatus Value of the INT_STATUS register
+ * @return True if the state changed
+ */
+template <typename WIRE>
+bool MPU6050PowerManager<WIRE>::processIntStatus(uint8_t intStatus) {
+    bool motion = intStatus & (1 << MPU6050_INTERRUPT_MOT_BIT);
+    if (state == MPU6050_POWER_WAKE_ON_MOTION) {
+        if (!motion) return false;
+        enterStreaming();
+        return true;
+    }
+    if (motion) {
+        lastActivity = millis();
+    } else if (millis() - lastActivity >= idleTimeout) {
+        enterWakeOnMotion();
+        return true;
+    }
+    return false;
+}
+
+/** Get the current power state.
+ * @return MPU6050_POWER_STREAMING or MPU6050_POWER_WAKE_ON_MOTION
+ */
+template <typename WIRE>
+uint8_t MPU6050PowerManager<WIRE>::getState() {
+    return state;
+}
+
+/** Get the upper bound of the time from motion onset to streaming data.
+ * In cycle mode the accelerometer takes one sample per wake period, so the
+ * motion counter needs up to [duration] periods to trigger; the gyroscope
+ * start-up time is added on top.
+ * @return Worst-case wake-up latency in milliseconds
+ */
+template <typename WIRE>
+uint16_t MPU6050PowerManager<WIRE>::getMaxWakeLatency() {
+    // 1.25, 2.5, 5 and 10Hz wake rates
+    uint16_t period = 800 >> (wakeFrequency & 0x03);
+    return period * (duration > 0 ? duration : 1) + MPU6050_GYRO_STARTUP_MS;
+}
+
+/** Enter low-power accelerometer-only cycle mode.
+ * The gyroscopes and temperature sensor are put in standby, the clock falls
+ * back to the internal oscillator (the gyro PLL is unavailable) and the device
+ * wakes at the configured rate to take a single accelerometer sample.
+ */
+template <typename WIRE>
+void MPU6050PowerManager<WIRE>::enterWakeOnMotion() {
+    device->setClockSource(MPU6050_CLOCK_INTERNAL);
+    device->setStandbyXGyroEnabled(true);
+    device->setStandbyYGyroEnabled(true);
+    device->setStandbyZGyroEnabled(true);
+    device->setTempSensorEnabled(false);
+    device->setWakeFrequency(wakeFrequency);
+    device->setWakeCycleEnabled(true);
+    device->getIntStatus();
+    state = MPU6050_POWER_WAKE_ON_MOTION;
+    if (callback != 0) callback(state);
+}
+
+/** Return to full-rate streaming.
+ * Gyroscope data is valid after MPU6050_GYRO_STARTUP_MS.
+ */
+template <typename WIRE>
+void MPU6050PowerManager<WIRE>::enterStreaming() {
+    device->setWakeCycleEnabled(false);
+    device->setStandbyXGyroEnabled(false);
+    device->setStandbyYGyroEnabled(false);
+    device->setStandbyZGyroEnabled(false);
+    device->setTempSensorEnabled(true);
+    device->setClockSource(clockSource);
+    state = MPU6050_POWER_STREAMING;
+    lastActivity = millis();
+    if (callback != 0) callback(state);
+}
+
+#endif /* _MPU6050_POWERMANAGER_H_ */
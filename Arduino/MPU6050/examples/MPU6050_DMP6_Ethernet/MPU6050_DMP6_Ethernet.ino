@@ -50,8 +50,9 @@ THE SOFTWARE.
 // specific I2C addresses may be passed as a parameter here
 // AD0 low = 0x68 (default for SparkFun breakout and InvenSense evaluation board)
 // AD0 high = 0x69
-MPU6050 mpu;
-//MPU6050 mpu(0x69); // <-- use for AD0 high
+I2Cdev i2cdev(Wire);
+MPU6050<TwoWire> mpu(i2cdev);
+//MPU6050<TwoWire> mpu(i2cdev, 0x69); // <-- use for AD0 high
 
 // MAC address from Ethernet shield sticker under board
 byte mac[] = {
@@ -46,8 +46,9 @@ THE SOFTWARE.
 // specific I2C addresses may be passed as a parameter here
 // AD0 low = 0x68 (default for InvenSense evaluation board)
 // AD0 high = 0x69
-MPU6050 accelgyro;
-//MPU6050 accelgyro(0x69); // <-- use for AD0 high
+I2Cdev i2cdev(Wire);
+MPU6050<TwoWire> accelgyro(i2cdev);
+//MPU6050<TwoWire> accelgyro(i2cdev, 0x69); // <-- use for AD0 high
 
 int16_t ax, ay, az;
 int16_t gx, gy, gz;
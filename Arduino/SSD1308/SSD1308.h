@@ -55,6 +55,11 @@ THE SOFTWARE.
 #define MAX_PAGE (PAGES - 1)
 #define MAX_COL (COLUMNS - 1)
 
+// data bytes per I2C write; the Wire buffer also holds the control byte
+#ifndef SSD1308_BURST_LENGTH
+#define SSD1308_BURST_LENGTH 31
+#endif
+
 #define HORIZONTAL_ADDRESSING_MODE 0x00
 #define VERTICAL_ADDRESSING_MODE   0x01
 #define PAGE_ADDRESSING_MODE       0x02
@@ -220,6 +225,9 @@ class SSD1308
 
     void sendData(uint8_t data);
     void sendData(uint8_t len, uint8_t* data);
+
+    // copies the 8 column bytes of a font character (0x20 - 0x7F) to glyph
+    static void getGlyph(char chr, uint8_t* glyph);
     // write the configuration registers in accordance with the datasheet and app note 3944
 //    void initialize();
     
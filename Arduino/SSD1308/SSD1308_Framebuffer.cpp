@@ -0,0 +1,229 @@
+// I2Cdev library collection - SSD1308 RAM framebuffer
+// Keeps a 1 KB copy of display RAM with per-page dirty column ranges and
+// flushes only the changed spans in Wire-buffer-sized data bursts
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Andrew Schamp
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "SSD1308_Framebuffer.h"
+
+SSD1308Framebuffer::SSD1308Framebuffer(SSD1308* display) :
+  m_display(display)
+{
+  clear();
+}
+
+void SSD1308Framebuffer::clear()
+{
+  fill(0x00);
+}
+
+void SSD1308Framebuffer::fill(uint8_t pattern)
+{
+  for (uint8_t page = 0; page < PAGES; page++)
+  {
+    for (uint8_t col = 0; col < COLUMNS; col++)
+    {
+      m_buffer[page][col] = pattern;
+    }
+  }
+  invalidate();
+}
+
+void SSD1308Framebuffer::setPixel(uint8_t x, uint8_t y, bool on)
+{
+  if (x >= COLUMNS || y >= ROWS) return;
+  uint8_t page = y / 8;
+  uint8_t mask = 1 << (y & 7);
+  uint8_t b = on ? (m_buffer[page][x] | mask) : (m_buffer[page][x] & ~mask);
+  if (b == m_buffer[page][x]) return;
+  m_buffer[page][x] = b;
+  markDirty(page, x, x);
+}
+
+bool SSD1308Framebuffer::getPixel(uint8_t x, uint8_t y)
+{
+  if (x >= COLUMNS || y >= ROWS) return false;
+  return m_buffer[y / 8][x] & (1 << (y & 7));
+}
+
+void SSD1308Framebuffer::drawHLine(uint8_t x, uint8_t y, uint8_t w, bool on)
+{
+  fillRect(x, y, w, 1, on);
+}
+
+void SSD1308Framebuffer::drawVLine(uint8_t x, uint8_t y, uint8_t h, bool on)
+{
+  fillRect(x, y, 1, h, on);
+}
+
+void SSD1308Framebuffer::drawRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, bool on)
+{
+  if (w == 0 || h == 0) return;
+  fillRect(x, y, w, 1, on);
+  fillRect(x, y + h - 1, w, 1, on);
+  fillRect(x, y, 1, h, on);
+  fillRect(x + w - 1, y, 1, h, on);
+}
+
+void SSD1308Framebuffer::fillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, bool on)
+{
+  if (x >= COLUMNS || y >= ROWS || w == 0 || h == 0) return;
+  uint8_t x1 = (uint16_t)x + w > COLUMNS ? MAX_COL : x + w - 1;
+  uint8_t y1 = (uint16_t)y + h > ROWS ? ROWS - 1 : y + h - 1;
+
+  // one mask per page, so a rectangle costs one read-modify-write per byte
+  for (uint8_t page = y / 8; page <= y1 / 8; page++)
+  {
+    uint8_t top = page == y / 8 ? (y & 7) : 0;
+    uint8_t bottom = page == y1 / 8 ? (y1 & 7) : 7;
+    uint8_t mask = (0xFF << top) & (0xFF >> (7 - bottom));
+    for (uint8_t col = x; col <= x1; col++)
+    {
+      m_buffer[page][col] = on ? (m_buffer[page][col] | mask) : (m_buffer[page][col] & ~mask);
+    }
+    markDirty(page, x, x1);
+  }
+}
+
+void SSD1308Framebuffer::writeChar(uint8_t row, uint8_t col, char chr)
+{
+  if (row >= PAGES || col >= CHARS) return;
+  uint8_t* dst = &m_buffer[row][FONT_WIDTH * col];
+  SSD1308::getGlyph(chr, dst);
+  markDirty(row, FONT_WIDTH * col, FONT_WIDTH * col + FONT_WIDTH - 1);
+}
+
+void SSD1308Framebuffer::writeString(uint8_t row, uint8_t col, uint16_t len, const char* txt)
+{
+  uint8_t r = row;
+  uint8_t c = col;
+  for (uint16_t i = 0; i < len; i++)
+  {
+    if (c >= CHARS)
+    {
+      c = 0;
+      r++;
+    }
+    if (r >= PAGES) r = 0; // wrap around from the top again
+    writeChar(r, c++, txt[i]);
+  }
+}
+
+uint8_t* SSD1308Framebuffer::getPage(uint8_t page)
+{
+  return page < PAGES ? m_buffer[page] : 0;
+}
+
+void SSD1308Framebuffer::markDirty(uint8_t page, uint8_t start, uint8_t end)
+{
+  if (page >= PAGES || start > end || start >= COLUMNS) return;
+  if (end > MAX_COL) end = MAX_COL;
+  if (m_dirtyStart[page] == SSD1308_FRAMEBUFFER_CLEAN)
+  {
+    m_dirtyStart[page] = start;
+    m_dirtyEnd[page] = end;
+    return;
+  }
+  if (start < m_dirtyStart[page]) m_dirtyStart[page] = start;
+  if (end > m_dirtyEnd[page]) m_dirtyEnd[page] = end;
+}
+
+void SSD1308Framebuffer::invalidate()
+{
+  for (uint8_t page = 0; page < PAGES; page++)
+  {
+    m_dirtyStart[page] = 0;
+    m_dirtyEnd[page] = MAX_COL;
+  }
+}
+
+bool SSD1308Framebuffer::isDirty()
+{
+  for (uint8_t page = 0; page < PAGES; page++)
+  {
+    if (m_dirtyStart[page] != SSD1308_FRAMEBUFFER_CLEAN) return true;
+  }
+  return false;
+}
+
+// Each dirty page gets a column window matching its span and its bytes are
+// sent in bursts of SSD1308_BURST_LENGTH. In horizontal addressing mode the
+// RAM pointer moves on to the next page at the end of the window, so runs of
+// dirty pages with the same span are addressed once and streamed as a single
+// block; a full redraw is two addressing commands and 34 bursts instead of
+// 1024 single-byte writes.
+uint8_t SSD1308Framebuffer::flush()
+{
+  uint8_t bursts = 0;
+  uint8_t page = 0;
+  while (page < PAGES)
+  {
+    if (m_dirtyStart[page] == SSD1308_FRAMEBUFFER_CLEAN)
+    {
+      page++;
+      continue;
+    }
+
+    uint8_t start = m_dirtyStart[page];
+    uint8_t end = m_dirtyEnd[page];
+    uint8_t last = page;
+    while (last + 1 < PAGES && m_dirtyStart[last + 1] == start && m_dirtyEnd[last + 1] == end)
+    {
+      last++;
+    }
+    m_display->setPageAddress(page, last);
+    m_display->setColumnAddress(start, end);
+
+    // the window wraps from column end to column start of the next page, so
+    // a burst may cross page boundaries
+    uint8_t chunk[SSD1308_BURST_LENGTH];
+    uint8_t p = page;
+    uint8_t col = start;
+    while (p <= last)
+    {
+      uint8_t len = 0;
+      while (len < SSD1308_BURST_LENGTH && p <= last)
+      {
+        chunk[len++] = m_buffer[p][col];
+        if (col++ == end)
+        {
+          col = start;
+          p++;
+        }
+      }
+      m_display->sendData(len, chunk);
+      bursts++;
+    }
+
+    for (; page <= last; page++)
+    {
+      m_dirtyStart[page] = SSD1308_FRAMEBUFFER_CLEAN;
+    }
+  }
+  return bursts;
+}
@@ -0,0 +1,81 @@
+// I2Cdev library collection - SSD1308 RAM framebuffer
+// Keeps a 1 KB copy of display RAM with per-page dirty column ranges and
+// flushes only the changed spans in Wire-buffer-sized data bursts
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Andrew Schamp
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _SSD1308_Framebuffer_h_
+#define _SSD1308_Framebuffer_h_
+
+#include "SSD1308.h"
+
+// marks a page with no pending changes
+#define SSD1308_FRAMEBUFFER_CLEAN 0xFF
+
+class SSD1308Framebuffer
+{
+  public:
+
+    // the display must stay valid for the lifetime of the framebuffer and
+    // be in horizontal addressing mode (the default after initialize())
+    SSD1308Framebuffer(SSD1308* display);
+
+    // drawing only changes RAM; nothing is sent until flush()
+    void clear();
+    void fill(uint8_t pattern = 0xFF);
+
+    // x is the column (0-127), y is the row (0-63), starting at top-left
+    void setPixel(uint8_t x, uint8_t y, bool on = true);
+    bool getPixel(uint8_t x, uint8_t y);
+    void drawHLine(uint8_t x, uint8_t y, uint8_t w, bool on = true);
+    void drawVLine(uint8_t x, uint8_t y, uint8_t h, bool on = true);
+    void drawRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, bool on = true);
+    void fillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, bool on = true);
+
+    // row is the page (0-7), col is the character cell (0-15), same as
+    // SSD1308::writeString(); text wraps to the next row and then to the top
+    void writeChar(uint8_t row, uint8_t col, char chr);
+    void writeString(uint8_t row, uint8_t col, uint16_t len, const char* txt);
+
+    // raw access, call markDirty() after changing bytes directly
+    uint8_t* getPage(uint8_t page);
+    void markDirty(uint8_t page, uint8_t start, uint8_t end);
+    void invalidate();
+    bool isDirty();
+
+    // sends the dirty spans, returns the number of data bursts written
+    uint8_t flush();
+
+  private:
+    SSD1308* m_display;
+    uint8_t m_buffer[PAGES][COLUMNS];
+    uint8_t m_dirtyStart[PAGES];
+    uint8_t m_dirtyEnd[PAGES];
+};
+
+#endif
@@ -12,6 +12,9 @@
 
 //Standard Libraries
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
 #include <msp430.h>
 #include "msp430_i2c.h"
 
@@ -19,4 +22,20 @@
 
 #define millis() 0
 
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#endif
+#ifndef max
+#define max(a,b) ((a)>(b)?(a):(b))
+#endif
+
+// busy-wait delay, used by the shared device cores (e.g. MPU6050 DMP init)
+#ifndef F_CPU
+#define F_CPU 16000000UL // MCLK frequency
+#endif
+
+static inline void delay(unsigned int ms) {
+    while (ms--) __delay_cycles(F_CPU / 1000);
+}
+
 #endif /* ARDUINOWRAPPER_H_ */
@@ -0,0 +1,97 @@
+// I2Cdev library collection - MSP430 bus policy for the shared I2Cdev core
+// Routes I2CdevT register access through the msp430_i2c USCI driver
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "I2Cdev_MSP430.h"
+
+/** Read multiple bytes from an 8-bit device register.
+ * The USCI driver blocks until the transfer is done and reports no status,
+ * so a completed call always counts as the full length.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in
+ * @return Number of bytes read
+ */
+template<>
+int8_t I2CdevT<MSP430Wire, uint8_t>::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    I2C_readBytesFromAddress(devAddr, regAddr, length, data);
+    return length;
+}
+
+/** Read multiple words from a 16-bit device register.
+ * The words are read in one burst into the caller's buffer and converted from
+ * the device's MSB-first order in place.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of words to read (not more than 127)
+ * @param data Buffer to store read data in
+ * @return Number of words read
+ */
+template<>
+int8_t I2CdevT<MSP430Wire, uint8_t>::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data) {
+    uint8_t *bytes = (uint8_t *)data;
+    I2C_readBytesFromAddress(devAddr, regAddr, length * 2, bytes);
+    for (uint8_t i = 0; i < length; i++) {
+        // both bytes of word i are read before it is overwritten
+        data[i] = ((uint16_t)bytes[i * 2] << 8) | bytes[i * 2 + 1];
+    }
+    return length;
+}
+
+/** Write multiple bytes to an 8-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+template<>
+bool I2CdevT<MSP430Wire, uint8_t>::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    I2C_writeBytesToAddress(devAddr, regAddr, length, data);
+    return true;
+}
+
+/** Write multiple words to a 16-bit device register.
+ * The driver sends straight from the caller's buffer, so the words are
+ * swapped to MSB-first in place for the transfer and swapped back after it
+ * (MSP430 is little-endian).
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of words to write (not more than 127)
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+template<>
+bool I2CdevT<MSP430Wire, uint8_t>::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data) {
+    for (uint8_t i = 0; i < length; i++) data[i] = (data[i] << 8) | (data[i] >> 8);
+    I2C_writeBytesToAddress(devAddr, regAddr, length * 2, (uint8_t *)data);
+    for (uint8_t i = 0; i < length; i++) data[i] = (data[i] << 8) | (data[i] >> 8);
+    return true;
+}
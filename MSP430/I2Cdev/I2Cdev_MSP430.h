@@ -0,0 +1,67 @@
+// I2Cdev library collection - MSP430 bus policy for the shared I2Cdev core
+// Routes I2CdevT register access through the msp430_i2c USCI driver
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEV_MSP430_H_
+#define _I2CDEV_MSP430_H_
+
+#ifdef ARDUINO
+    // Energia provides TwoWire, so the shared core works without this policy
+    #include "msp430_i2c.h"
+#else
+    #include "ArduinoWrapper.h"
+#endif
+
+// Shared core, included by path so it wins over the legacy static I2Cdev.h
+// in this directory. Both use the same include guard, so device headers
+// that later do #include "I2Cdev.h" pick up the core that is already loaded.
+#include "../../Arduino/I2Cdev/I2Cdev.h"
+
+/** Bus type for I2CdevT on MSP430.
+ * The msp430_i2c driver keeps its state in module-level variables, so this
+ * carries no data of its own; it only gives the templates a type to
+ * specialize the transfer functions on.
+ */
+class MSP430Wire {
+    public:
+        void begin() { I2C_masterInit(); }
+};
+
+template<>
+int8_t I2CdevT<MSP430Wire, uint8_t>::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+template<>
+int8_t I2CdevT<MSP430Wire, uint8_t>::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+template<>
+bool I2CdevT<MSP430Wire, uint8_t>::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+template<>
+bool I2CdevT<MSP430Wire, uint8_t>::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+
+typedef I2CdevT<MSP430Wire, uint8_t> I2CdevMSP430;
+
+#endif /* _I2CDEV_MSP430_H_ */
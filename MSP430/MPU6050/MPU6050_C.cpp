@@ -0,0 +1,1086 @@
+// I2Cdev library collection - MPU6050 C interface
+// C-callable wrappers around the shared MPU6050 core, using the same
+// MPU6050_<method>() names as the PIC18 and Jennic ports so C code written
+// against those can run on MSP430 unchanged
+//
+// Changelog:
+//     ... - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+
+#include "MPU6050_C.h"
+#include "MPU6050.h"
+
+// every wrapper below instantiates its MPU6050 method; the unused ones are
+// only dropped when linking with --gc-sections (see MPU6050_C.h)
+
+// the MPU6050 only answers at one of two addresses, so keep a device object
+// for each and let MPU6050_setAddress() pick one
+static MSP430Wire bus;
+static I2CdevMSP430 i2cdev(bus);
+static MPU6050<MSP430Wire> mpuLow(i2cdev, MPU6050_ADDRESS_AD0_LOW);
+static MPU6050<MSP430Wire> mpuHigh(i2cdev, MPU6050_ADDRESS_AD0_HIGH);
+static MPU6050<MSP430Wire> *mpu = &mpuLow;
+
+void MPU6050_setAddress(uint8_t address) {
+    mpu = (address == MPU6050_ADDRESS_AD0_HIGH) ? &mpuHigh : &mpuLow;
+}
+
+void MPU6050_initialize() {
+    mpu->initialize();
+}
+
+bool MPU6050_testConnection() {
+    return mpu->testConnection();
+}
+
+uint8_t MPU6050_getAuxVDDIOLevel() {
+    return mpu->getAuxVDDIOLevel();
+}
+
+void MPU6050_setAuxVDDIOLevel(uint8_t level) {
+    mpu->setAuxVDDIOLevel(level);
+}
+
+uint8_t MPU6050_getRate() {
+    return mpu->getRate();
+}
+
+void MPU6050_setRate(uint8_t rate) {
+    mpu->setRate(rate);
+}
+
+uint8_t MPU6050_getExternalFrameSync() {
+    return mpu->getExternalFrameSync();
+}
+
+void MPU6050_setExternalFrameSync(uint8_t sync) {
+    mpu->setExternalFrameSync(sync);
+}
+
+uint8_t MPU6050_getDLPFMode() {
+    return mpu->getDLPFMode();
+}
+
+void MPU6050_setDLPFMode(uint8_t bandwidth) {
+    mpu->setDLPFMode(bandwidth);
+}
+
+uint8_t MPU6050_getFullScaleGyroRange() {
+    return mpu->getFullScaleGyroRange();
+}
+
+void MPU6050_setFullScaleGyroRange(uint8_t range) {
+    mpu->setFullScaleGyroRange(range);
+}
+
+bool MPU6050_getAccelXSelfTest() {
+    return mpu->getAccelXSelfTest();
+}
+
+void MPU6050_setAccelXSelfTest(bool enabled) {
+    mpu->setAccelXSelfTest(enabled);
+}
+
+bool MPU6050_getAccelYSelfTest() {
+    return mpu->getAccelYSelfTest();
+}
+
+void MPU6050_setAccelYSelfTest(bool enabled) {
+    mpu->setAccelYSelfTest(enabled);
+}
+
+bool MPU6050_getAccelZSelfTest() {
+    return mpu->getAccelZSelfTest();
+}
+
+void MPU6050_setAccelZSelfTest(bool enabled) {
+    mpu->setAccelZSelfTest(enabled);
+}
+
+uint8_t MPU6050_getFullScaleAccelRange() {
+    return mpu->getFullScaleAccelRange();
+}
+
+void MPU6050_setFullScaleAccelRange(uint8_t range) {
+    mpu->setFullScaleAccelRange(range);
+}
+
+uint8_t MPU6050_getDHPFMode() {
+    return mpu->getDHPFMode();
+}
+
+void MPU6050_setDHPFMode(uint8_t mode) {
+    mpu->setDHPFMode(mode);
+}
+
+uint8_t MPU6050_getFreefallDetectionThreshold() {
+    return mpu->getFreefallDetectionThreshold();
+}
+
+void MPU6050_setFreefallDetectionThreshold(uint8_t threshold) {
+    mpu->setFreefallDetectionThreshold(threshold);
+}
+
+uint8_t MPU6050_getFreefallDetectionDuration() {
+    return mpu->getFreefallDetectionDuration();
+}
+
+void MPU6050_setFreefallDetectionDuration(uint8_t duration) {
+    mpu->setFreefallDetectionDuration(duration);
+}
+
+uint8_t MPU6050_getMotionDetectionThreshold() {
+    return mpu->getMotionDetectionThreshold();
+}
+
+void MPU6050_setMotionDetectionThreshold(uint8_t threshold) {
+    mpu->setMotionDetectionThreshold(threshold);
+}
+
+uint8_t MPU6050_getMotionDetectionDuration() {
+    return mpu->getMotionDetectionDuration();
+}
+
+void MPU6050_setMotionDetectionDuration(uint8_t duration) {
+    mpu->setMotionDetectionDuration(duration);
+}
+
+uint8_t MPU6050_getZeroMotionDetectionThreshold() {
+    return mpu->getZeroMotionDetectionThreshold();
+}
+
+void MPU6050_setZeroMotionDetectionThreshold(uint8_t threshold) {
+    mpu->setZeroMotionDetectionThreshold(threshold);
+}
+
+uint8_t MPU6050_getZeroMotionDetectionDuration() {
+    return mpu->getZeroMotionDetectionDuration();
+}
+
+void MPU6050_setZeroMotionDetectionDuration(uint8_t duration) {
+    mpu->setZeroMotionDetectionDuration(duration);
+}
+
+bool MPU6050_getTempFIFOEnabled() {
+    return mpu->getTempFIFOEnabled();
+}
+
+void MPU6050_setTempFIFOEnabled(bool enabled) {
+    mpu->setTempFIFOEnabled(enabled);
+}
+
+bool MPU6050_getXGyroFIFOEnabled() {
+    return mpu->getXGyroFIFOEnabled();
+}
+
+void MPU6050_setXGyroFIFOEnabled(bool enabled) {
+    mpu->setXGyroFIFOEnabled(enabled);
+}
+
+bool MPU6050_getYGyroFIFOEnabled() {
+    return mpu->getYGyroFIFOEnabled();
+}
+
+void MPU6050_setYGyroFIFOEnabled(bool enabled) {
+    mpu->setYGyroFIFOEnabled(enabled);
+}
+
+bool MPU6050_getZGyroFIFOEnabled() {
+    return mpu->getZGyroFIFOEnabled();
+}
+
+void MPU6050_setZGyroFIFOEnabled(bool enabled) {
+    mpu->setZGyroFIFOEnabled(enabled);
+}
+
+bool MPU6050_getAccelFIFOEnabled() {
+    return mpu->getAccelFIFOEnabled();
+}
+
+void MPU6050_setAccelFIFOEnabled(bool enabled) {
+    mpu->setAccelFIFOEnabled(enabled);
+}
+
+bool MPU6050_getSlave2FIFOEnabled() {
+    return mpu->getSlave2FIFOEnabled();
+}
+
+void MPU6050_setSlave2FIFOEnabled(bool enabled) {
+    mpu->setSlave2FIFOEnabled(enabled);
+}
+
+bool MPU6050_getSlave1FIFOEnabled() {
+    return mpu->getSlave1FIFOEnabled();
+}
+
+void MPU6050_setSlave1FIFOEnabled(bool enabled) {
+    mpu->setSlave1FIFOEnabled(enabled);
+}
+
+bool MPU6050_getSlave0FIFOEnabled() {
+    return mpu->getSlave0FIFOEnabled();
+}
+
+void MPU6050_setSlave0FIFOEnabled(bool enabled) {
+    mpu->setSlave0FIFOEnabled(enabled);
+}
+
+bool MPU6050_getMultiMasterEnabled() {
+    return mpu->getMultiMasterEnabled();
+}
+
+void MPU6050_setMultiMasterEnabled(bool enabled) {
+    mpu->setMultiMasterEnabled(enabled);
+}
+
+bool MPU6050_getWaitForExternalSensorEnabled() {
+    return mpu->getWaitForExternalSensorEnabled();
+}
+
+void MPU6050_setWaitForExternalSensorEnabled(bool enabled) {
+    mpu->setWaitForExternalSensorEnabled(enabled);
+}
+
+bool MPU6050_getSlave3FIFOEnabled() {
+    return mpu->getSlave3FIFOEnabled();
+}
+
+void MPU6050_setSlave3FIFOEnabled(bool enabled) {
+    mpu->setSlave3FIFOEnabled(enabled);
+}
+
+bool MPU6050_getSlaveReadWriteTransitionEnabled() {
+    return mpu->getSlaveReadWriteTransitionEnabled();
+}
+
+void MPU6050_setSlaveReadWriteTransitionEnabled(bool enabled) {
+    mpu->setSlaveReadWriteTransitionEnabled(enabled);
+}
+
+uint8_t MPU6050_getMasterClockSpeed() {
+    return mpu->getMasterClockSpeed();
+}
+
+void MPU6050_setMasterClockSpeed(uint8_t speed) {
+    mpu->setMasterClockSpeed(speed);
+}
+
+uint8_t MPU6050_getSlaveAddress(uint8_t num) {
+    return mpu->getSlaveAddress(num);
+}
+
+void MPU6050_setSlaveAddress(uint8_t num, uint8_t address) {
+    mpu->setSlaveAddress(num, address);
+}
+
+uint8_t MPU6050_getSlaveRegister(uint8_t num) {
+    return mpu->getSlaveRegister(num);
+}
+
+void MPU6050_setSlaveRegister(uint8_t num, uint8_t reg) {
+    mpu->setSlaveRegister(num, reg);
+}
+
+bool MPU6050_getSlaveEnabled(uint8_t num) {
+    return mpu->getSlaveEnabled(num);
+}
+
+void MPU6050_setSlaveEnabled(uint8_t num, bool enabled) {
+    mpu->setSlaveEnabled(num, enabled);
+}
+
+bool MPU6050_getSlaveWordByteSwap(uint8_t num) {
+    return mpu->getSlaveWordByteSwap(num);
+}
+
+void MPU6050_setSlaveWordByteSwap(uint8_t num, bool enabled) {
+    mpu->setSlaveWordByteSwap(num, enabled);
+}
+
+bool MPU6050_getSlaveWriteMode(uint8_t num) {
+    return mpu->getSlaveWriteMode(num);
+}
+
+void MPU6050_setSlaveWriteMode(uint8_t num, bool mode) {
+    mpu->setSlaveWriteMode(num, mode);
+}
+
+bool MPU6050_getSlaveWordGroupOffset(uint8_t num) {
+    return mpu->getSlaveWordGroupOffset(num);
+}
+
+void MPU6050_setSlaveWordGroupOffset(uint8_t num, bool enabled) {
+    mpu->setSlaveWordGroupOffset(num, enabled);
+}
+
+uint8_t MPU6050_getSlaveDataLength(uint8_t num) {
+    return mpu->getSlaveDataLength(num);
+}
+
+void MPU6050_setSlaveDataLength(uint8_t num, uint8_t length) {
+    mpu->setSlaveDataLength(num, length);
+}
+
+uint8_t MPU6050_getSlave4Address() {
+    return mpu->getSlave4Address();
+}
+
+void MPU6050_setSlave4Address(uint8_t address) {
+    mpu->setSlave4Address(address);
+}
+
+uint8_t MPU6050_getSlave4Register() {
+    return mpu->getSlave4Register();
+}
+
+void MPU6050_setSlave4Register(uint8_t reg) {
+    mpu->setSlave4Register(reg);
+}
+
+void MPU6050_setSlave4OutputByte(uint8_t data) {
+    mpu->setSlave4OutputByte(data);
+}
+
+bool MPU6050_getSlave4Enabled() {
+    return mpu->getSlave4Enabled();
+}
+
+void MPU6050_setSlave4Enabled(bool enabled) {
+    mpu->setSlave4Enabled(enabled);
+}
+
+bool MPU6050_getSlave4InterruptEnabled() {
+    return mpu->getSlave4InterruptEnabled();
+}
+
+void MPU6050_setSlave4InterruptEnabled(bool enabled) {
+    mpu->setSlave4InterruptEnabled(enabled);
+}
+
+bool MPU6050_getSlave4WriteMode() {
+    return mpu->getSlave4WriteMode();
+}
+
+void MPU6050_setSlave4WriteMode(bool mode) {
+    mpu->setSlave4WriteMode(mode);
+}
+
+uint8_t MPU6050_getSlave4MasterDelay() {
+    return mpu->getSlave4MasterDelay();
+}
+
+void MPU6050_setSlave4MasterDelay(uint8_t delay) {
+    mpu->setSlave4MasterDelay(delay);
+}
+
+uint8_t MPU6050_getSlate4InputByte() {
+    return mpu->getSlate4InputByte();
+}
+
+bool MPU6050_getPassthroughStatus() {
+    return mpu->getPassthroughStatus();
+}
+
+bool MPU6050_getSlave4IsDone() {
+    return mpu->getSlave4IsDone();
+}
+
+bool MPU6050_getLostArbitration() {
+    return mpu->getLostArbitration();
+}
+
+bool MPU6050_getSlave4Nack() {
+    return mpu->getSlave4Nack();
+}
+
+bool MPU6050_getSlave3Nack() {
+    return mpu->getSlave3Nack();
+}
+
+bool MPU6050_getSlave2Nack() {
+    return mpu->getSlave2Nack();
+}
+
+bool MPU6050_getSlave1Nack() {
+    return mpu->getSlave1Nack();
+}
+
+bool MPU6050_getSlave0Nack() {
+    return mpu->getSlave0Nack();
+}
+
+bool MPU6050_getInterruptMode() {
+    return mpu->getInterruptMode();
+}
+
+void MPU6050_setInterruptMode(bool mode) {
+    mpu->setInterruptMode(mode);
+}
+
+bool MPU6050_getInterruptDrive() {
+    return mpu->getInterruptDrive();
+}
+
+void MPU6050_setInterruptDrive(bool drive) {
+    mpu->setInterruptDrive(drive);
+}
+
+bool MPU6050_getInterruptLatch() {
+    return mpu->getInterruptLatch();
+}
+
+void MPU6050_setInterruptLatch(bool latch) {
+    mpu->setInterruptLatch(latch);
+}
+
+bool MPU6050_getInterruptLatchClear() {
+    return mpu->getInterruptLatchClear();
+}
+
+void MPU6050_setInterruptLatchClear(bool clear) {
+    mpu->setInterruptLatchClear(clear);
+}
+
+bool MPU6050_getFSyncInterruptLevel() {
+    return mpu->getFSyncInterruptLevel();
+}
+
+void MPU6050_setFSyncInterruptLevel(bool level) {
+    mpu->setFSyncInterruptLevel(level);
+}
+
+bool MPU6050_getFSyncInterruptEnabled() {
+    return mpu->getFSyncInterruptEnabled();
+}
+
+void MPU6050_setFSyncInterruptEnabled(bool enabled) {
+    mpu->setFSyncInterruptEnabled(enabled);
+}
+
+bool MPU6050_getI2CBypassEnabled() {
+    return mpu->getI2CBypassEnabled();
+}
+
+void MPU6050_setI2CBypassEnabled(bool enabled) {
+    mpu->setI2CBypassEnabled(enabled);
+}
+
+bool MPU6050_getClockOutputEnabled() {
+    return mpu->getClockOutputEnabled();
+}
+
+void MPU6050_setClockOutputEnabled(bool enabled) {
+    mpu->setClockOutputEnabled(enabled);
+}
+
+uint8_t MPU6050_getIntEnabled() {
+    return mpu->getIntEnabled();
+}
+
+void MPU6050_setIntEnabled(uint8_t enabled) {
+    mpu->setIntEnabled(enabled);
+}
+
+bool MPU6050_getIntFreefallEnabled() {
+    return mpu->getIntFreefallEnabled();
+}
+
+void MPU6050_setIntFreefallEnabled(bool enabled) {
+    mpu->setIntFreefallEnabled(enabled);
+}
+
+bool MPU6050_getIntMotionEnabled() {
+    return mpu->getIntMotionEnabled();
+}
+
+void MPU6050_setIntMotionEnabled(bool enabled) {
+    mpu->setIntMotionEnabled(enabled);
+}
+
+bool MPU6050_getIntZeroMotionEnabled() {
+    return mpu->getIntZeroMotionEnabled();
+}
+
+void MPU6050_setIntZeroMotionEnabled(bool enabled) {
+    mpu->setIntZeroMotionEnabled(enabled);
+}
+
+bool MPU6050_getIntFIFOBufferOverflowEnabled() {
+    return mpu->getIntFIFOBufferOverflowEnabled();
+}
+
+void MPU6050_setIntFIFOBufferOverflowEnabled(bool enabled) {
+    mpu->setIntFIFOBufferOverflowEnabled(enabled);
+}
+
+bool MPU6050_getIntI2CMasterEnabled() {
+    return mpu->getIntI2CMasterEnabled();
+}
+
+void MPU6050_setIntI2CMasterEnabled(bool enabled) {
+    mpu->setIntI2CMasterEnabled(enabled);
+}
+
+bool MPU6050_getIntDataReadyEnabled() {
+    return mpu->getIntDataReadyEnabled();
+}
+
+void MPU6050_setIntDataReadyEnabled(bool enabled) {
+    mpu->setIntDataReadyEnabled(enabled);
+}
+
+uint8_t MPU6050_getIntStatus() {
+    return mpu->getIntStatus();
+}
+
+bool MPU6050_getIntFreefallStatus() {
+    return mpu->getIntFreefallStatus();
+}
+
+bool MPU6050_getIntMotionStatus() {
+    return mpu->getIntMotionStatus();
+}
+
+bool MPU6050_getIntZeroMotionStatus() {
+    return mpu->getIntZeroMotionStatus();
+}
+
+bool MPU6050_getIntFIFOBufferOverflowStatus() {
+    return mpu->getIntFIFOBufferOverflowStatus();
+}
+
+bool MPU6050_getIntI2CMasterStatus() {
+    return mpu->getIntI2CMasterStatus();
+}
+
+bool MPU6050_getIntDataReadyStatus() {
+    return mpu->getIntDataReadyStatus();
+}
+
+void MPU6050_getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz, int16_t* mx, int16_t* my, int16_t* mz) {
+    mpu->getMotion9(ax, ay, az, gx, gy, gz, mx, my, mz);
+}
+
+void MPU6050_getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz) {
+    mpu->getMotion6(ax, ay, az, gx, gy, gz);
+}
+
+void MPU6050_getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
+    mpu->getAcceleration(x, y, z);
+}
+
+int16_t MPU6050_getAccelerationX() {
+    return mpu->getAccelerationX();
+}
+
+int16_t MPU6050_getAccelerationY() {
+    return mpu->getAccelerationY();
+}
+
+int16_t MPU6050_getAccelerationZ() {
+    return mpu->getAccelerationZ();
+}
+
+int16_t MPU6050_getTemperature() {
+    return mpu->getTemperature();
+}
+
+void MPU6050_getRotation(int16_t* x, int16_t* y, int16_t* z) {
+    mpu->getRotation(x, y, z);
+}
+
+int16_t MPU6050_getRotationX() {
+    return mpu->getRotationX();
+}
+
+int16_t MPU6050_getRotationY() {
+    return mpu->getRotationY();
+}
+
+int16_t MPU6050_getRotationZ() {
+    return mpu->getRotationZ();
+}
+
+uint8_t MPU6050_getExternalSensorByte(int position) {
+    return mpu->getExternalSensorByte(position);
+}
+
+uint16_t MPU6050_getExternalSensorWord(int position) {
+    return mpu->getExternalSensorWord(position);
+}
+
+uint32_t MPU6050_getExternalSensorDWord(int position) {
+    return mpu->getExternalSensorDWord(position);
+}
+
+bool MPU6050_getXNegMotionDetected() {
+    return mpu->getXNegMotionDetected();
+}
+
+bool MPU6050_getXPosMotionDetected() {
+    return mpu->getXPosMotionDetected();
+}
+
+bool MPU6050_getYNegMotionDetected() {
+    return mpu->getYNegMotionDetected();
+}
+
+bool MPU6050_getYPosMotionDetected() {
+    return mpu->getYPosMotionDetected();
+}
+
+bool MPU6050_getZNegMotionDetected() {
+    return mpu->getZNegMotionDetected();
+}
+
+bool MPU6050_getZPosMotionDetected() {
+    return mpu->getZPosMotionDetected();
+}
+
+bool MPU6050_getZeroMotionDetected() {
+    return mpu->getZeroMotionDetected();
+}
+
+void MPU6050_setSlaveOutputByte(uint8_t num, uint8_t data) {
+    mpu->setSlaveOutputByte(num, data);
+}
+
+bool MPU6050_getExternalShadowDelayEnabled() {
+    return mpu->getExternalShadowDelayEnabled();
+}
+
+void MPU6050_setExternalShadowDelayEnabled(bool enabled) {
+    mpu->setExternalShadowDelayEnabled(enabled);
+}
+
+bool MPU6050_getSlaveDelayEnabled(uint8_t num) {
+    return mpu->getSlaveDelayEnabled(num);
+}
+
+void MPU6050_setSlaveDelayEnabled(uint8_t num, bool enabled) {
+    mpu->setSlaveDelayEnabled(num, enabled);
+}
+
+void MPU6050_resetGyroscopePath() {
+    mpu->resetGyroscopePath();
+}
+
+void MPU6050_resetAccelerometerPath() {
+    mpu->resetAccelerometerPath();
+}
+
+void MPU6050_resetTemperaturePath() {
+    mpu->resetTemperaturePath();
+}
+
+uint8_t MPU6050_getAccelerometerPowerOnDelay() {
+    return mpu->getAccelerometerPowerOnDelay();
+}
+
+void MPU6050_setAccelerometerPowerOnDelay(uint8_t delay) {
+    mpu->setAccelerometerPowerOnDelay(delay);
+}
+
+uint8_t MPU6050_getFreefallDetectionCounterDecrement() {
+    return mpu->getFreefallDetectionCounterDecrement();
+}
+
+void MPU6050_setFreefallDetectionCounterDecrement(uint8_t decrement) {
+    mpu->setFreefallDetectionCounterDecrement(decrement);
+}
+
+uint8_t MPU6050_getMotionDetectionCounterDecrement() {
+    return mpu->getMotionDetectionCounterDecrement();
+}
+
+void MPU6050_setMotionDetectionCounterDecrement(uint8_t decrement) {
+    mpu->setMotionDetectionCounterDecrement(decrement);
+}
+
+bool MPU6050_getFIFOEnabled() {
+    return mpu->getFIFOEnabled();
+}
+
+void MPU6050_setFIFOEnabled(bool enabled) {
+    mpu->setFIFOEnabled(enabled);
+}
+
+bool MPU6050_getI2CMasterModeEnabled() {
+    return mpu->getI2CMasterModeEnabled();
+}
+
+void MPU6050_setI2CMasterModeEnabled(bool enabled) {
+    mpu->setI2CMasterModeEnabled(enabled);
+}
+
+void MPU6050_switchSPIEnabled(bool enabled) {
+    mpu->switchSPIEnabled(enabled);
+}
+
+void MPU6050_resetFIFO() {
+    mpu->resetFIFO();
+}
+
+void MPU6050_resetI2CMaster() {
+    mpu->resetI2CMaster();
+}
+
+void MPU6050_resetSensors() {
+    mpu->resetSensors();
+}
+
+void MPU6050_reset() {
+    mpu->reset();
+}
+
+bool MPU6050_getSleepEnabled() {
+    return mpu->getSleepEnabled();
+}
+
+void MPU6050_setSleepEnabled(bool enabled) {
+    mpu->setSleepEnabled(enabled);
+}
+
+bool MPU6050_getWakeCycleEnabled() {
+    return mpu->getWakeCycleEnabled();
+}
+
+void MPU6050_setWakeCycleEnabled(bool enabled) {
+    mpu->setWakeCycleEnabled(enabled);
+}
+
+bool MPU6050_getTempSensorEnabled() {
+    return mpu->getTempSensorEnabled();
+}
+
+void MPU6050_setTempSensorEnabled(bool enabled) {
+    mpu->setTempSensorEnabled(enabled);
+}
+
+uint8_t MPU6050_getClockSource() {
+    return mpu->getClockSource();
+}
+
+void MPU6050_setClockSource(uint8_t source) {
+    mpu->setClockSource(source);
+}
+
+uint8_t MPU6050_getWakeFrequency() {
+    return mpu->getWakeFrequency();
+}
+
+void MPU6050_setWakeFrequency(uint8_t frequency) {
+    mpu->setWakeFrequency(frequency);
+}
+
+bool MPU6050_getStandbyXAccelEnabled() {
+    return mpu->getStandbyXAccelEnabled();
+}
+
+void MPU6050_setStandbyXAccelEnabled(bool enabled) {
+    mpu->setStandbyXAccelEnabled(enabled);
+}
+
+bool MPU6050_getStandbyYAccelEnabled() {
+    return mpu->getStandbyYAccelEnabled();
+}
+
+void MPU6050_setStandbyYAccelEnabled(bool enabled) {
+    mpu->setStandbyYAccelEnabled(enabled);
+}
+
+bool MPU6050_getStandbyZAccelEnabled() {
+    return mpu->getStandbyZAccelEnabled();
+}
+
+void MPU6050_setStandbyZAccelEnabled(bool enabled) {
+    mpu->setStandbyZAccelEnabled(enabled);
+}
+
+bool MPU6050_getStandbyXGyroEnabled() {
+    return mpu->getStandbyXGyroEnabled();
+}
+
+void MPU6050_setStandbyXGyroEnabled(bool enabled) {
+    mpu->setStandbyXGyroEnabled(enabled);
+}
+
+bool MPU6050_getStandbyYGyroEnabled() {
+    return mpu->getStandbyYGyroEnabled();
+}
+
+void MPU6050_setStandbyYGyroEnabled(bool enabled) {
+    mpu->setStandbyYGyroEnabled(enabled);
+}
+
+bool MPU6050_getStandbyZGyroEnabled() {
+    return mpu->getStandbyZGyroEnabled();
+}
+
+void MPU6050_setStandbyZGyroEnabled(bool enabled) {
+    mpu->setStandbyZGyroEnabled(enabled);
+}
+
+uint16_t MPU6050_getFIFOCount() {
+    return mpu->getFIFOCount();
+}
+
+uint8_t MPU6050_getFIFOByte() {
+    return mpu->getFIFOByte();
+}
+
+void MPU6050_setFIFOByte(uint8_t data) {
+    mpu->setFIFOByte(data);
+}
+
+void MPU6050_getFIFOBytes(uint8_t *data, uint8_t length) {
+    mpu->getFIFOBytes(data, length);
+}
+
+uint8_t MPU6050_getDeviceID() {
+    return mpu->getDeviceID();
+}
+
+void MPU6050_setDeviceID(uint8_t id) {
+    mpu->setDeviceID(id);
+}
+
+uint8_t MPU6050_getOTPBankValid() {
+    return mpu->getOTPBankValid();
+}
+
+void MPU6050_setOTPBankValid(bool enabled) {
+    mpu->setOTPBankValid(enabled);
+}
+
+int8_t MPU6050_getXGyroOffsetTC() {
+    return mpu->getXGyroOffsetTC();
+}
+
+void MPU6050_setXGyroOffsetTC(int8_t offset) {
+    mpu->setXGyroOffsetTC(offset);
+}
+
+int8_t MPU6050_getYGyroOffsetTC() {
+    return mpu->getYGyroOffsetTC();
+}
+
+void MPU6050_setYGyroOffsetTC(int8_t offset) {
+    mpu->setYGyroOffsetTC(offset);
+}
+
+int8_t MPU6050_getZGyroOffsetTC() {
+    return mpu->getZGyroOffsetTC();
+}
+
+void MPU6050_setZGyroOffsetTC(int8_t offset) {
+    mpu->setZGyroOffsetTC(offset);
+}
+
+int8_t MPU6050_getXFineGain() {
+    return mpu->getXFineGain();
+}
+
+void MPU6050_setXFineGain(int8_t gain) {
+    mpu->setXFineGain(gain);
+}
+
+int8_t MPU6050_getYFineGain() {
+    return mpu->getYFineGain();
+}
+
+void MPU6050_setYFineGain(int8_t gain) {
+    mpu->setYFineGain(gain);
+}
+
+int8_t MPU6050_getZFineGain() {
+    return mpu->getZFineGain();
+}
+
+void MPU6050_setZFineGain(int8_t gain) {
+    mpu->setZFineGain(gain);
+}
+
+int16_t MPU6050_getXAccelOffset() {
+    return mpu->getXAccelOffset();
+}
+
+void MPU6050_setXAccelOffset(int16_t offset) {
+    mpu->setXAccelOffset(offset);
+}
+
+int16_t MPU6050_getYAccelOffset() {
+    return mpu->getYAccelOffset();
+}
+
+void MPU6050_setYAccelOffset(int16_t offset) {
+    mpu->setYAccelOffset(offset);
+}
+
+int16_t MPU6050_getZAccelOffset() {
+    return mpu->getZAccelOffset();
+}
+
+void MPU6050_setZAccelOffset(int16_t offset) {
+    mpu->setZAccelOffset(offset);
+}
+
+int16_t MPU6050_getXGyroOffset() {
+    return mpu->getXGyroOffset();
+}
+
+void MPU6050_setXGyroOffset(int16_t offset) {
+    mpu->setXGyroOffset(offset);
+}
+
+int16_t MPU6050_getYGyroOffset() {
+    return mpu->getYGyroOffset();
+}
+
+void MPU6050_setYGyroOffset(int16_t offset) {
+    mpu->setYGyroOffset(offset);
+}
+
+int16_t MPU6050_getZGyroOffset() {
+    return mpu->getZGyroOffset();
+}
+
+void MPU6050_setZGyroOffset(int16_t offset) {
+    mpu->setZGyroOffset(offset);
+}
+
+bool MPU6050_getIntPLLReadyEnabled() {
+    return mpu->getIntPLLReadyEnabled();
+}
+
+void MPU6050_setIntPLLReadyEnabled(bool enabled) {
+    mpu->setIntPLLReadyEnabled(enabled);
+}
+
+bool MPU6050_getIntDMPEnabled() {
+    return mpu->getIntDMPEnabled();
+}
+
+void MPU6050_setIntDMPEnabled(bool enabled) {
+    mpu->setIntDMPEnabled(enabled);
+}
+
+bool MPU6050_getDMPInt5Status() {
+    return mpu->getDMPInt5Status();
+}
+
+bool MPU6050_getDMPInt4Status() {
+    return mpu->getDMPInt4Status();
+}
+
+bool MPU6050_getDMPInt3Status() {
+    return mpu->getDMPInt3Status();
+}
+
+bool MPU6050_getDMPInt2Status() {
+    return mpu->getDMPInt2Status();
+}
+
+bool MPU6050_getDMPInt1Status() {
+    return mpu->getDMPInt1Status();
+}
+
+bool MPU6050_getDMPInt0Status() {
+    return mpu->getDMPInt0Status();
+}
+
+bool MPU6050_getIntPLLReadyStatus() {
+    return mpu->getIntPLLReadyStatus();
+}
+
+bool MPU6050_getIntDMPStatus() {
+    return mpu->getIntDMPStatus();
+}
+
+bool MPU6050_getDMPEnabled() {
+    return mpu->getDMPEnabled();
+}
+
+void MPU6050_setDMPEnabled(bool enabled) {
+    mpu->setDMPEnabled(enabled);
+}
+
+void MPU6050_resetDMP() {
+    mpu->resetDMP();
+}
+
+void MPU6050_setMemoryBank(uint8_t bank, bool prefetchEnabled, bool userBank) {
+    mpu->setMemoryBank(bank, prefetchEnabled, userBank);
+}
+
+void MPU6050_setMemoryStartAddress(uint8_t address) {
+    mpu->setMemoryStartAddress(address);
+}
+
+uint8_t MPU6050_readMemoryByte() {
+    return mpu->readMemoryByte();
+}
+
+void MPU6050_writeMemoryByte(uint8_t data) {
+    mpu->writeMemoryByte(data);
+}
+
+void MPU6050_readMemoryBlock(uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address) {
+    mpu->readMemoryBlock(data, dataSize, bank, address);
+}
+
+bool MPU6050_writeMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify, bool useProgMem) {
+    return mpu->writeMemoryBlock(data, dataSize, bank, address, verify, useProgMem);
+}
+
+bool MPU6050_writeProgMemoryBlock(const uint8_t *data, uint16_t dataSize, uint8_t bank, uint8_t address, bool verify) {
+    return mpu->writeProgMemoryBlock(data, dataSize, bank, address, verify);
+}
+
+bool MPU6050_writeDMPConfigurationSet(const uint8_t *data, uint16_t dataSize, bool useProgMem) {
+    return mpu->writeDMPConfigurationSet(data, dataSize, useProgMem);
+}
+
+bool MPU6050_writeProgDMPConfigurationSet(const uint8_t *data, uint16_t dataSize) {
+    return mpu->writeProgDMPConfigurationSet(data, dataSize);
+}
+
+uint8_t MPU6050_getDMPConfig1() {
+    return mpu->getDMPConfig1();
+}
+
+void MPU6050_setDMPConfig1(uint8_t config) {
+    mpu->setDMPConfig1(config);
+}
+
+uint8_t MPU6050_getDMPConfig2() {
+    return mpu->getDMPConfig2();
+}
+
+void MPU6050_setDMPConfig2(uint8_t config) {
+    mpu->setDMPConfig2(config);
+}